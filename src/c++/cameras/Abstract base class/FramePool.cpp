@@ -0,0 +1,197 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <new>
+#include "FramePool.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/*****************************************************************************************************
+	 * Pool
+	 *****************************************************************************************************/
+
+	/*! Destructor (frees pooled buffers, buffers in use must have been released before).
+	*/
+	FramePool::~FramePool(void) {
+		trim();
+	}
+
+	/*! Get pool shared by all classes (e.g., VideoStream and cameras).
+	*
+	* The pool is created on first use and never destroyed, so that it outlives Mats with static
+	* storage duration.
+	*
+	* \return Default pool
+	*/
+	FramePool& FramePool::getDefault(void) {
+		static FramePool* pool = new FramePool();
+		return *pool;
+	}
+
+	/*! Use pool for all Mats allocating memory without an allocator of their own (e.g., clone()).
+	*/
+	void FramePool::setAsDefaultAllocator(void) {
+		Mat::setDefaultAllocator(this);
+	}
+
+	/*****************************************************************************************************
+	 * Frames
+	 *****************************************************************************************************/
+
+	/*! Let a Mat reference a pooled buffer of given size and type.
+	*
+	* The Mat releases its previous data first. Other Mats sharing the previous data are therefore not
+	* overwritten, and an unshared buffer of the same size is returned to the pool and reused at once.
+	*
+	* \param frame [out] Mat to reference pooled buffer
+	* \param size [in] Frame size
+	* \param type [in] Frame type (e.g., CV_8UC3)
+	*/
+	void FramePool::create(Mat& frame, Size size, int type) {
+		frame.release();
+		frame.allocator = this;
+		frame.create(size, type);
+	}
+
+	/*! Copy a Mat into a pooled buffer (as clone() without heap allocations).
+	*
+	* \param source [in] Mat to copy (may be frame)
+	* \param frame [out] Copy in pooled buffer
+	*/
+	void FramePool::copy(const Mat& source, Mat& frame) {
+		Mat original = source;		// Keeps data, if source and frame are the same Mat
+
+		create(frame, original.size(), original.type());
+		original.copyTo(frame);
+	}
+
+	/*****************************************************************************************************
+	 * Statistics and memory
+	 *****************************************************************************************************/
+
+	/*! Get allocation statistics.
+	*
+	* \return Statistics since creation of pool
+	*/
+	framePoolStats FramePool::getStatistics(void) const {
+		lock_guard<mutex> lock(poolMutex);
+		return statistics;
+	}
+
+	/*! Free all pooled buffers (buffers in use are not affected).
+	*/
+	void FramePool::trim(void) {
+		lock_guard<mutex> lock(poolMutex);
+
+		for (auto& entry : freeBuffers) {
+			for (UMatData* u : entry.second) {
+				fastFree(u->origdata);
+				statistics.bytesAllocated -= u->size;
+				delete u;
+			}
+			statistics.buffersPooled -= (int)entry.second.size();
+		}
+		freeBuffers.clear();
+	}
+
+	/*****************************************************************************************************
+	 * Interface cv::MatAllocator
+	 *****************************************************************************************************/
+
+	/*! Allocate buffer for a Mat (called by Mat::create()).
+	*
+	* Steps are computed as by OpenCV's standard allocator. A pooled buffer of the required size is
+	* reused, if available. Requests for user-provided data are passed to the standard allocator.
+	*
+	* \param dims [in] Number of dimensions
+	* \param sizes [in] Size of each dimension
+	* \param type [in] Element type
+	* \param data [in] User-provided data (or NULL)
+	* \param step [in/out] Step of each dimension (computed, if not provided with data)
+	* \param flags [in] Access flags
+	* \param usageFlags [in] Usage flags
+	* \return Buffer descriptor
+	*/
+	UMatData* FramePool::allocate(int dims, const int* sizes, int type, void* data, size_t* step, AccessFlag flags, UMatUsageFlags usageFlags) const {
+		if (data != NULL)
+			return Mat::getStdAllocator()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+
+		// Size in bytes and steps
+		size_t total = CV_ELEM_SIZE(type);
+		for (int i = dims - 1; i >= 0; i--) {
+			if (step != NULL)
+				step[i] = total;
+			total *= sizes[i];
+		}
+
+		// Reuse pooled buffer
+		{
+			lock_guard<mutex> lock(poolMutex);
+			auto entry = freeBuffers.find(total);
+
+			if ((entry != freeBuffers.end()) && !(entry->second.empty())) {
+				UMatData* u = entry->second.back();
+				entry->second.pop_back();
+				statistics.numberReused++;
+				statistics.buffersPooled--;
+				statistics.buffersInUse++;
+				return u;
+			}
+		}
+
+		// Allocate new buffer
+		UMatData* u = new UMatData(this);
+		u->data = u->origdata = (uchar*)fastMalloc(total);
+		u->size = total;
+
+		lock_guard<mutex> lock(poolMutex);
+		statistics.numberAllocated++;
+		statistics.bytesAllocated += total;
+		statistics.buffersInUse++;
+		return u;
+	}
+
+	/*! Nothing to do for host memory.
+	*
+	* \return true if buffer exists
+	*/
+	bool FramePool::allocate(UMatData* u, AccessFlag accessFlags, UMatUsageFlags usageFlags) const {
+		return (u != NULL);
+	}
+
+	/*! Return buffer to pool (called on release of last Mat referencing it).
+	*
+	* The buffer descriptor is reset for reuse without freeing the buffer.
+	*
+	* \param u [in] Buffer descriptor
+	*/
+	void FramePool::deallocate(UMatData* u) const {
+		if (u == NULL)
+			return;
+
+		uchar* data = u->origdata;
+		size_t size = u->size;
+		u->~UMatData();
+		new (u) UMatData(this);
+		u->data = u->origdata = data;
+		u->size = size;
+
+		lock_guard<mutex> lock(poolMutex);
+		freeBuffers[size].push_back(u);
+		statistics.numberReturned++;
+		statistics.buffersInUse--;
+		statistics.buffersPooled++;
+	}
+}
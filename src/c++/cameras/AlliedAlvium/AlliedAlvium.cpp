@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2025, Marc Hensel
- * Version: 2025.11.25
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -13,6 +13,7 @@
 /* Includes */
 #include <mutex>
 #include "AlliedAlvium.h"
+#include "FramePool.h"
 
 /*****************************************************************************************************
  * Frame observer class
@@ -40,7 +41,7 @@ bool FrameObserver::getNextFrame(Mat& frame) {
 	bool isSuccess = isNewFrame;
 
 	if (isNewFrame) {
-		frame = this->frame.clone();
+		FramePool::getDefault().copy(this->frame, frame);
 		isNewFrame = false;
 	}
 	mtx.unlock();
@@ -63,7 +64,7 @@ void FrameObserver::FrameReceived(const FramePtr rawFrame) {
 	rawFrame->GetImage(data);
 
 	mtx.lock();
-	frame = Mat((int)height, (int)width, cvPixelType, (void*)data).clone();
+	FramePool::getDefault().copy(Mat((int)height, (int)width, cvPixelType, (void*)data), frame);
 	isNewFrame = true;
 	mtx.unlock();
 
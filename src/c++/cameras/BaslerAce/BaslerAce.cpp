@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2025, Marc Hensel
- * Version: 2025.11.25
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -12,6 +12,7 @@
 
 /* Includes */
 #include "BaslerAce.h"
+#include "FramePool.h"
 
 /*****************************************************************************************************
  * Constructor
@@ -150,7 +151,7 @@ bool BaslerAce::getFrame(Mat& frame) {
 		if (grabResult->GrabSucceeded()) {
 			CPylonImage pylonFrame;
 			converter->Convert(pylonFrame, grabResult);
-			frame = Mat(grabResult->GetHeight(), grabResult->GetWidth(), cvPixelType, (uint8_t*)pylonFrame.GetBuffer()).clone();
+			FramePool::getDefault().copy(Mat(grabResult->GetHeight(), grabResult->GetWidth(), cvPixelType, (uint8_t*)pylonFrame.GetBuffer()), frame);
 			isGrabbed = true;
 		}
 	}
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2025, Marc Hensel
- * Version: 2025.03.11
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -12,6 +12,7 @@
 
 /* Includes */
 #include "CameraCV.h"
+#include "FramePool.h"
 
 /*****************************************************************************************************
  * Constructor
@@ -74,15 +75,18 @@ void CameraCV::release(void) {
 */
 bool CameraCV::getFrame(Mat& frame) {
 	// Get next frame from camera
-	this->capture >> frame;
-
-	if (!frame.empty()) {
-		// Create copy
-		frame = frame.clone();
-
-		// Convert to gray image
-		if (this->pixelFormat == PixelFormat::Mono8)
-			cvtColor(frame, frame, COLOR_BGR2GRAY);
+	this->capture >> this->capturedFrame;
+
+	if (!(this->capturedFrame.empty())) {
+		// Create copy in pooled buffer (converted to gray image)
+		FramePool& pool = FramePool::getDefault();
+
+		if (this->pixelFormat == PixelFormat::Mono8) {
+			pool.create(frame, this->capturedFrame.size(), CV_8U);
+			cvtColor(this->capturedFrame, frame, COLOR_BGR2GRAY);
+		}
+		else
+			pool.copy(this->capturedFrame, frame);
 
 		return true;
 	}
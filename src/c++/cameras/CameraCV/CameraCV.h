@@ -7,7 +7,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2025, Marc Hensel
- * Version: 2025.03.07
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -23,6 +23,7 @@ class CameraCV : public ip::Camera {
 private:
 	VideoCapture capture;
 	PixelFormat pixelFormat;
+	Mat capturedFrame;		// Frame as captured (buffer reused)
 
 public:
 	// Constructor and release camera
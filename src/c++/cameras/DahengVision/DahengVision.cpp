@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2025, Marc Hensel
- * Version: 2025.12.15
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -13,6 +13,7 @@
 
  /* Includes */
 #include "DahengVision.h"
+#include "FramePool.h"
 
 /*****************************************************************************************************
  * Constructor
@@ -158,12 +159,12 @@ bool DahengVision::getFrame(Mat& frame) {
 	// Convert to OpenCV format
 	if (pixelFormat == PixelFormat::BGR8) {
 		void* data = rawImage->ConvertToRGB24(GX_BIT_0_7, GX_RAW2RGB_NEIGHBOUR, false);
-		frame = Mat((int)rawImage->GetHeight(), (int)rawImage->GetWidth(), CV_8UC3, data).clone();
-		cvtColor(frame, frame, COLOR_RGB2BGR);
+		FramePool::getDefault().create(frame, Size((int)rawImage->GetWidth(), (int)rawImage->GetHeight()), CV_8UC3);
+		cvtColor(Mat((int)rawImage->GetHeight(), (int)rawImage->GetWidth(), CV_8UC3, data), frame, COLOR_RGB2BGR);
 	}
 	else {
 		void* data = rawImage->ConvertToRaw8(GX_BIT_0_7);
-		frame = Mat((int)rawImage->GetHeight(), (int)rawImage->GetWidth(), CV_8U, data).clone();
+		FramePool::getDefault().copy(Mat((int)rawImage->GetHeight(), (int)rawImage->GetWidth(), CV_8U, data), frame);
 	}
 	return true;
 }
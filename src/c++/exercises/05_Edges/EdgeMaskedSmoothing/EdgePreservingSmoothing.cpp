@@ -0,0 +1,239 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include "EdgePreservingSmoothing.h"
+#include <cmath>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static void normalizedConvolution(const Mat& image, Mat& smoothed, double sigmaSpatial, double sigmaRange);
+	static void bilateralGrid(const Mat& image, Mat& smoothed, double sigmaSpatial, double sigmaRange);
+
+	/*! Edge-preserving smoothing.
+	*
+	* Methods:
+	* - NORMALIZED_CONVOLUTION: Gaussian smoothing where each pixel contributes with a certainty
+	*   c = exp(-|grad|^2 / (2 sigmaRange^2)). Pixels at edges hardly contribute to their neighbors
+	*   and keep their original values. As c is continuous, there are no seams at mask borders.
+	* - BILATERAL_GRID: Bilateral filter approximated on a downsampled grid (x, y, gray-value) with
+	*   cell size sigmaSpatial x sigmaSpatial x sigmaRange. The effort for blurring the grid decreases
+	*   with larger sigmas, the remaining effort is linear in the number of pixels.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param smoothed [out] Smoothed image (type CV_8U)
+	* \param method [in] Smoothing method
+	* \param sigmaSpatial [in] Standard deviation of the spatial Gaussian (pixels)
+	* \param sigmaRange [in] Range standard deviation: Gradient magnitude (normalized convolution) or gray-value difference (bilateral grid)
+	*/
+	void edgePreservingSmooth(const Mat& image, Mat& smoothed, SmoothingMethod method, double sigmaSpatial, double sigmaRange) {
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || (sigmaSpatial <= 0.0) || (sigmaRange <= 0.0))
+			return;
+
+		if (method == SmoothingMethod::NORMALIZED_CONVOLUTION)
+			normalizedConvolution(image, smoothed, sigmaSpatial, sigmaRange);
+		else
+			bilateralGrid(image, smoothed, sigmaSpatial, sigmaRange);
+	}
+
+	/*! Edge-preserving smoothing by normalized convolution with gradient-based certainties.
+	*
+	* Reference: H. Knutsson, C.-F. Westin: Normalized and differential convolution, CVPR 1993, pp. 515-523.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param smoothed [out] Smoothed image (type CV_8U)
+	* \param sigmaSpatial [in] Standard deviation of the spatial Gaussian (pixels)
+	* \param sigmaRange [in] Gradient magnitude (gray-values per pixel) at which certainty drops to exp(-0.5)
+	*/
+	static void normalizedConvolution(const Mat& image, Mat& smoothed, double sigmaSpatial, double sigmaRange) {
+		// Gradients (3x3 Sobel scaled to gray-values per pixel)
+		Mat gradX, gradY;
+		Sobel(image, gradX, CV_32F, 1, 0, 3, 1.0 / 8.0);
+		Sobel(image, gradY, CV_32F, 0, 1, 3, 1.0 / 8.0);
+
+		// Certainty c and weighted image c * g in one pass
+		Mat certainty(image.size(), CV_32F), weighted(image.size(), CV_32F);
+		float rangeFactor = (float)(-0.5 / (sigmaRange * sigmaRange));
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				const float* rowX = gradX.ptr<float>(y);
+				const float* rowY = gradY.ptr<float>(y);
+				float* cRow = certainty.ptr<float>(y);
+				float* wRow = weighted.ptr<float>(y);
+
+				for (int x = 0; x < image.cols; x++) {
+					float c = exp(rangeFactor * (rowX[x] * rowX[x] + rowY[x] * rowY[x]));
+					cRow[x] = c;
+					wRow[x] = c * srcRow[x];
+				}
+			}
+		});
+
+		// Smooth certainty and weighted image
+		Mat smoothedCertainty, smoothedWeighted;
+		GaussianBlur(certainty, smoothedCertainty, Size(0, 0), sigmaSpatial, sigmaSpatial, BORDER_REPLICATE);
+		GaussianBlur(weighted, smoothedWeighted, Size(0, 0), sigmaSpatial, sigmaSpatial, BORDER_REPLICATE);
+
+		// Normalize and blend with original image depending on the pixel's certainty
+		smoothed.create(image.size(), CV_8U);
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				const float* cRow = certainty.ptr<float>(y);
+				const float* scRow = smoothedCertainty.ptr<float>(y);
+				const float* swRow = smoothedWeighted.ptr<float>(y);
+				uchar* dstRow = smoothed.ptr<uchar>(y);
+
+				for (int x = 0; x < image.cols; x++) {
+					float value = (scRow[x] > 1.0e-6f) ? swRow[x] / scRow[x] : srcRow[x];
+					dstRow[x] = saturate_cast<uchar>(cRow[x] * value + (1.0f - cRow[x]) * srcRow[x]);
+				}
+			}
+		});
+	}
+
+	/*! Bilateral filter approximated by a bilateral grid.
+	*
+	* Reference: J. Chen, S. Paris, F. Durand: Real-time edge-aware image processing with the
+	* bilateral grid, ACM Transactions on Graphics 26(3), 2007.
+	*
+	* Steps:
+	* 1. Splat: Accumulate gray-values and counts in the grid cell (x / sS, y / sS, g / sR).
+	*    Bands of grid rows are accumulated in parallel, each from the image rows rounding to them.
+	* 2. Blur: Apply the 1D kernel [1 4 6 4 1] / 16 (sigma = 1 cell) along each grid dimension.
+	* 3. Slice: Trilinearly interpolate the grid at each pixel and normalize by the interpolated count.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param smoothed [out] Smoothed image (type CV_8U)
+	* \param sigmaSpatial [in] Standard deviation of the spatial Gaussian (pixels)
+	* \param sigmaRange [in] Standard deviation of the range Gaussian (gray-values)
+	*/
+	static void bilateralGrid(const Mat& image, Mat& smoothed, double sigmaSpatial, double sigmaRange) {
+		const int PAD = 3;		// Cells added at each border (blur radius and interpolation)
+
+		// Grid geometry (each cell holds sum of gray-values and number of pixels)
+		int gridWidth = (int)((image.cols - 1) / sigmaSpatial) + 1 + 2 * PAD;
+		int gridHeight = (int)((image.rows - 1) / sigmaSpatial) + 1 + 2 * PAD;
+		int gridDepth = (int)(255.0 / sigmaRange) + 1 + 2 * PAD;
+		size_t strideY = (size_t)gridWidth * gridDepth * 2;
+		size_t strideX = (size_t)gridDepth * 2;
+		size_t gridSize = strideY * gridHeight;
+		float invSpatial = (float)(1.0 / sigmaSpatial);
+		float invRange = (float)(1.0 / sigmaRange);
+
+		// 1. Splat (parallel over bands of grid rows, so that each band is written by one thread only)
+		int numberCellRows = cvRound((image.rows - 1) * invSpatial) + 1;
+		vector<int> cellRowStart(numberCellRows + 1, image.rows);	// First image row of each grid row
+
+		for (int y = image.rows - 1; y >= 0; y--)
+			cellRowStart[cvRound(y * invSpatial)] = y;
+		for (int cellRow = numberCellRows - 1; cellRow >= 0; cellRow--)
+			cellRowStart[cellRow] = std::min(cellRowStart[cellRow], cellRowStart[cellRow + 1]);
+
+		vector<float> grid(gridSize, 0.0f);
+
+		parallel_for_(Range(0, numberCellRows), [&](const Range& range) {
+			for (int y = cellRowStart[range.start]; y < cellRowStart[range.end]; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				size_t offsetY = (size_t)(cvRound(y * invSpatial) + PAD) * strideY;
+
+				for (int x = 0; x < image.cols; x++) {
+					size_t index = offsetY + (cvRound(x * invSpatial) + PAD) * strideX + (cvRound(srcRow[x] * invRange) + PAD) * 2;
+					grid[index] += srcRow[x];
+					grid[index + 1] += 1.0f;
+				}
+			}
+		});
+
+		// 2. Blur grid along each dimension (z, x, y) with kernel [1 4 6 4 1] / 16
+		vector<float> buffer(gridSize);
+		const float kernel[5] = { 1.0f / 16.0f, 4.0f / 16.0f, 6.0f / 16.0f, 4.0f / 16.0f, 1.0f / 16.0f };
+		int lengths[3] = { gridDepth, gridWidth, gridHeight };
+		size_t strides[3] = { 2, strideX, strideY };
+
+		for (int dim = 0; dim < 3; dim++) {
+			size_t stride = strides[dim];
+			int length = lengths[dim];
+
+			parallel_for_(Range(0, gridHeight), [&](const Range& range) {
+				for (int gy = range.start; gy < range.end; gy++) {
+					for (size_t i = (size_t)gy * strideY; i < (size_t)(gy + 1) * strideY; i += 2) {
+						// Position of cell along current dimension
+						int pos = (int)((i / stride) % length);
+
+						// Border cells are not blurred (they remain empty)
+						if ((pos < 2) || (pos >= length - 2)) {
+							buffer[i] = grid[i];
+							buffer[i + 1] = grid[i + 1];
+							continue;
+						}
+
+						float sumValue = 0.0f, sumCount = 0.0f;
+						for (int k = -2; k <= 2; k++) {
+							size_t neighbor = i + k * stride;
+							sumValue += kernel[k + 2] * grid[neighbor];
+							sumCount += kernel[k + 2] * grid[neighbor + 1];
+						}
+						buffer[i] = sumValue;
+						buffer[i + 1] = sumCount;
+					}
+				}
+			});
+			grid.swap(buffer);
+		}
+
+		// 3. Slice (trilinear interpolation, parallel over rows)
+		smoothed.create(image.size(), CV_8U);
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				uchar* dstRow = smoothed.ptr<uchar>(y);
+				float gy = y * invSpatial + PAD;
+				int iy = (int)gy;
+				float fy = gy - iy;
+
+				for (int x = 0; x < image.cols; x++) {
+					float gx = x * invSpatial + PAD;
+					float gz = srcRow[x] * invRange + PAD;
+					int ix = (int)gx, iz = (int)gz;
+					float fx = gx - ix, fz = gz - iz;
+					float value = 0.0f, count = 0.0f;
+
+					for (int dy = 0; dy <= 1; dy++) {
+						float wy = dy ? fy : 1.0f - fy;
+						for (int dx = 0; dx <= 1; dx++) {
+							float wxy = wy * (dx ? fx : 1.0f - fx);
+							size_t index = (iy + dy) * strideY + (ix + dx) * strideX + iz * 2;
+
+							float w0 = wxy * (1.0f - fz);
+							float w1 = wxy * fz;
+							value += w0 * grid[index] + w1 * grid[index + 2];
+							count += w0 * grid[index + 1] + w1 * grid[index + 3];
+						}
+					}
+
+					dstRow[x] = (count > 1.0e-6f) ? saturate_cast<uchar>(value / count) : srcRow[x];
+				}
+			}
+		});
+	}
+}
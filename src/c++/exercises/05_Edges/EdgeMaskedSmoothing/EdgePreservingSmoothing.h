@@ -0,0 +1,27 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_EDGE_PRESERVING_SMOOTHING_H
+#define IP_EDGE_PRESERVING_SMOOTHING_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Enumerations */
+	enum class SmoothingMethod { NORMALIZED_CONVOLUTION, BILATERAL_GRID };
+
+	/* Prototypes */
+	void edgePreservingSmooth(const cv::Mat& image, cv::Mat& smoothed, SmoothingMethod method, double sigmaSpatial, double sigmaRange);
+}
+
+#endif /* IP_EDGE_PRESERVING_SMOOTHING_H */
@@ -1,11 +1,11 @@
 /*****************************************************************************************************
  * Lecture sample code.
- * Edge-preserving smoothing controlled by mask of edge pixels.
+ * Edge-preserving smoothing by normalized convolution and bilateral grid.
  *****************************************************************************************************
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.11.01
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -14,13 +14,15 @@
 #include <iostream>
 #include <string>
 #include <opencv2/opencv.hpp>
+#include "EdgePreservingSmoothing.h"
 
 /* Defines */
 #define DATA_ROOT_PATH getenv("ImagingData")  // Read environment variable
 #define INPUT_IMAGE "/images/misc/Parrot.jpg"
 
-#define INITIAL_THRESH_1 300
-#define INITIAL_THRESH_2 65
+#define SIGMA_SPATIAL 2.0			// Spatial smoothing (pixels)
+#define SIGMA_GRADIENT 6.0			// Normalized convolution: Gradient magnitude to preserve
+#define SIGMA_RANGE 20.0			// Bilateral grid: Gray-value difference to preserve
 #define SAVE_IMAGE_FILES false
 
 /* Namespaces */
@@ -39,39 +41,21 @@ int main()
 		return 0;
 	}
 
-	// Canny edge detector
-	Mat edgeMask;
-	Canny(image, edgeMask, INITIAL_THRESH_1, INITIAL_THRESH_2);
-
-	// Apply 3x3 maximum filter for binary values in {0, 255}
-	boxFilter(edgeMask, edgeMask, CV_8U, Size(3, 3));
-	for (int y = 0; y < edgeMask.rows; y++) {
-		uchar* row = edgeMask.ptr<uchar>(y);
-		for (int x = 0; x < edgeMask.cols; x++) {
-			row[x] = 255 * (row[x] > 0);
-		}
-	}
-
-	// Apply Gaussian smoothing filter
-	Mat preservedEdges, smoothedImage;
-	GaussianBlur(image, smoothedImage, Size(5, 5), 0.0);
-	preservedEdges = smoothedImage.clone();
-
-	// Preserve edges (copy from original image)
-	image.copyTo(preservedEdges, edgeMask);
+	// Edge-preserving smoothing
+	Mat normConvImage, bilateralImage;
+	ip::edgePreservingSmooth(image, normConvImage, ip::SmoothingMethod::NORMALIZED_CONVOLUTION, SIGMA_SPATIAL, SIGMA_GRADIENT);
+	ip::edgePreservingSmooth(image, bilateralImage, ip::SmoothingMethod::BILATERAL_GRID, SIGMA_SPATIAL, SIGMA_RANGE);
 
 	// Display images
 	imshow("Image", image);
-	imshow("Edges to preserve", edgeMask);
-	imshow("Smoothed image", smoothedImage);
-	imshow("Smoothed with preserved edges", preservedEdges);
+	imshow("Normalized convolution", normConvImage);
+	imshow("Bilateral grid", bilateralImage);
 
 	// Save image files
 #if SAVE_IMAGE_FILES == true
 	imwrite("D:/MaskedSmoothing_Image.jpg", image);
-	imwrite("D:/MaskedSmoothing_Mask.jpg", edgeMask);
-	imwrite("D:/MaskedSmoothing_Smoothed.jpg", smoothedImage);
-	imwrite("D:/MaskedSmoothing_PreservedEdges.jpg", preservedEdges);
+	imwrite("D:/MaskedSmoothing_NormalizedConvolution.jpg", normConvImage);
+	imwrite("D:/MaskedSmoothing_BilateralGrid.jpg", bilateralImage);
 #endif
 
 	// Wait for keypress and terminate
@@ -5,7 +5,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.10.31
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -16,11 +16,16 @@
 #include <iostream>
 #include <string>
 #include <opencv2/opencv.hpp>
+#include "ZeroCrossings.h"
 
 /* Defines */
 #define DATA_ROOT_PATH getenv("ImagingData")  // Read environment variable
 #define INPUT_IMAGE "/images/misc/Ton12.jpg"
 
+#define GAUSSIAN_SIGMA 1.4				// Corresponds to 7x7 Gaussian kernel
+#define MIN_GRADIENT 2.0				// Minimum gradient magnitude of edge pixels (0.0 to disable)
+#define LAPLACE_DISPLAY_GAIN 4.0
+
 /* Namespaces */
 using namespace cv;
 using namespace std;
@@ -37,34 +42,22 @@ int main()
 		return 0;
 	}
 
-	// Apply Gaussian smoothing (noise reduction)
-	Mat image16S;
-	image.convertTo(image16S, CV_16S, 128);
-	GaussianBlur(image16S, image16S, Size(7, 7), 0.0);
-
-	// Apply Laplacian operator L4
-	Mat laplace;
-	Mat kernel = (Mat_<double>(3, 3) << 0, 1, 0, 1, -4, 1, 0, 1, 0);
-	filter2D(image16S, laplace, CV_16S, kernel);
-	laplace.convertTo(laplace, CV_8S, 1.0 / 128.0);
-
-	// Mark zero-crossings as edge pixels
-	Mat edges(laplace.size(), CV_8U, Scalar(0));
+	// Smoothing, Laplacian, and zero-crossings in a single fused pass
+	Mat edges, laplace;
+	ip::logZeroCrossings(image, edges, GAUSSIAN_SIGMA, MIN_GRADIENT, &laplace);
+	laplace.convertTo(laplace, CV_8U, LAPLACE_DISPLAY_GAIN, 128.0);
 
-	for (int y = 1; y < laplace.rows; y++) {
-		char* lastSrcRow = laplace.ptr<char>(y-1);
-		char* srcRow = laplace.ptr<char>(y);
-		uchar* dstRow = edges.ptr<uchar>(y);
-
-		for (int x = 1; x < laplace.cols; x++) {
-			dstRow[x] = 255 * ((srcRow[x-1] * srcRow[x] < 0) + (lastSrcRow[x] * srcRow[x] < 0));
-		}
-	}
+	// Zero-crossings at multiple scales (reusing smoothed image of previous scale)
+	vector<Mat> scaleEdges;
+	vector<double> sigmas = { 1.0, 2.0, 4.0 };
+	ip::logZeroCrossingsMultiScale(image, scaleEdges, sigmas, MIN_GRADIENT);
 
 	// Display images in named window
 	imshow("Image", image);
-	imshow("Laplacian L4", laplace);
+	imshow("Laplacian of Gaussian", laplace);
 	imshow("Edge image", edges);
+	for (size_t i = 0; i < scaleEdges.size(); i++)
+		imshow(string("Edge image (sigma = ").append(to_string(sigmas[i]).substr(0, 3)).append(")"), scaleEdges[i]);
 
 	// Wait for keypress and terminate
 	waitKey(0);
@@ -0,0 +1,316 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include "ZeroCrossings.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Tile size of fused pass (buffers of a tile fit into the L2 cache) */
+	const int TILE_WIDTH = 256;
+	const int TILE_HEIGHT = 32;
+
+	/* Filter responses with smaller absolute values are regarded as zero (no sign) */
+	const float ZERO_EPSILON = 1.0e-3f;
+
+	/*! Sampled 1D Gaussian kernel and its first and second derivatives.
+	*
+	* The Gaussian is normalized to sum 1, the second derivative to sum 0 (i.e., no response in flat areas).
+	*
+	* \param sigma [in] Standard deviation
+	* \param g [out] Gaussian g(x)
+	* \param g1 [out] First derivative g'(x)
+	* \param g2 [out] Second derivative g''(x)
+	*/
+	static void gaussianKernels(double sigma, vector<float>& g, vector<float>& g1, vector<float>& g2) {
+		int radius = std::max(1, (int)ceil(3.0 * sigma));
+		int size = 2 * radius + 1;
+		double sigma2 = sigma * sigma;
+		vector<double> values(size);
+		double sum = 0.0;
+
+		for (int i = 0; i < size; i++) {
+			double x = i - radius;
+			values[i] = exp(-x * x / (2.0 * sigma2));
+			sum += values[i];
+		}
+
+		g.resize(size);
+		g1.resize(size);
+		g2.resize(size);
+		double sum2 = 0.0;
+
+		for (int i = 0; i < size; i++) {
+			double x = i - radius;
+			double value = values[i] / sum;
+			g[i] = (float)value;
+			g1[i] = (float)(-x / sigma2 * value);
+			g2[i] = (float)((x * x / (sigma2 * sigma2) - 1.0 / sigma2) * value);
+			sum2 += g2[i];
+		}
+
+		for (int i = 0; i < size; i++)
+			g2[i] -= (float)(sum2 / size);
+	}
+
+	/*! True, if the filter responses a and b have different signs. */
+	static inline bool isSignChange(float a, float b) {
+		return ((a > ZERO_EPSILON) && (b < -ZERO_EPSILON)) || ((a < -ZERO_EPSILON) && (b > ZERO_EPSILON));
+	}
+
+	/*! Detect edges as zero-crossings of the Laplacian of Gaussian (LoG).
+	*
+	* Fused single-pass implementation of the steps Gaussian smoothing, Laplacian, and zero-crossing detection:
+	* - The LoG is separable into Gxx + Gyy = g''(x) g(y) + g(x) g''(y), which is computed by 1D convolutions.
+	* - The image is processed in tiles (in parallel), so that all intermediate values stay in small buffers.
+	* - An edge pixel has a different sign than its left or upper neighbor (as in the exercise solution).
+	* - Optionally, zero-crossings with a small gradient magnitude of the smoothed image are discarded.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param edges [out] Edge image with values in {0, 255}
+	* \param sigma [in] Standard deviation of the Gaussian
+	* \param minGradient [in] Minimum gradient magnitude (gray-values per pixel) of edge pixels (0 to disable)
+	* \param laplacian [out] LoG filtered image (type CV_32F) or NULL
+	*/
+	void logZeroCrossings(const Mat& image, Mat& edges, double sigma, double minGradient, Mat* laplacian) {
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || (sigma <= 0.0))
+			return;
+
+		// Filter kernels
+		vector<float> g, g1, g2;
+		gaussianKernels(sigma, g, g1, g2);
+		int radius = (int)g.size() / 2;
+		int size = (int)g.size();
+		bool isGate = (minGradient > 0.0);
+		float minGradient2 = (float)(minGradient * minGradient);
+
+		// Init destination images
+		edges.create(image.size(), CV_8U);
+		if (laplacian != NULL)
+			laplacian->create(image.size(), CV_32F);
+
+		// Process tiles in parallel
+		int tilesX = (image.cols + TILE_WIDTH - 1) / TILE_WIDTH;
+		int tilesY = (image.rows + TILE_HEIGHT - 1) / TILE_HEIGHT;
+
+		parallel_for_(Range(0, tilesX * tilesY), [&](const Range& range) {
+			// Tile buffers, reused for all tiles of this range. Responses are calculated
+			// for one additional column and row to compare with left and upper neighbors.
+			int bufferWidth = TILE_WIDTH + 1;
+			int bufferHeight = TILE_HEIGHT + 1;
+			vector<float> srcRow(bufferWidth + 2 * radius);
+			vector<float> smoothX((bufferHeight + 2 * radius) * bufferWidth);
+			vector<float> deriv2X(smoothX.size());
+			vector<float> deriv1X(isGate ? smoothX.size() : 0);
+			vector<float> response(bufferHeight * bufferWidth);
+			vector<float> gradient2(isGate ? response.size() : 0);
+
+			for (int tile = range.start; tile < range.end; tile++) {
+				int x0 = (tile % tilesX) * TILE_WIDTH;
+				int y0 = (tile / tilesX) * TILE_HEIGHT;
+				int x1 = std::min(x0 + TILE_WIDTH, image.cols);
+				int y1 = std::min(y0 + TILE_HEIGHT, image.rows);
+				int width = x1 - x0 + 1;			// Including left neighbor column x0 - 1
+				int height = y1 - y0 + 1;			// Including upper neighbor row y0 - 1
+
+				// Horizontal 1D convolutions of rows [y0 - 1 - radius, y1 + radius)
+				for (int j = 0; j < height + 2 * radius; j++) {
+					int y = std::min(std::max(y0 - 1 - radius + j, 0), image.rows - 1);
+					const uchar* row = image.ptr<uchar>(y);
+
+					// Copy row with replicated border
+					for (int i = 0; i < width + 2 * radius; i++) {
+						int x = std::min(std::max(x0 - 1 - radius + i, 0), image.cols - 1);
+						srcRow[i] = row[x];
+					}
+
+					float* smooth = &smoothX[j * bufferWidth];
+					float* deriv2 = &deriv2X[j * bufferWidth];
+					float* deriv1 = isGate ? &deriv1X[j * bufferWidth] : NULL;
+
+					for (int i = 0; i < width; i++) {
+						const float* src = &srcRow[i];
+						float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f;
+
+						for (int k = 0; k < size; k++) {
+							sum0 += g[k] * src[k];
+							sum2 += g2[k] * src[k];
+						}
+						if (isGate) {
+							for (int k = 0; k < size; k++)
+								sum1 += g1[k] * src[k];
+							deriv1[i] = sum1;
+						}
+						smooth[i] = sum0;
+						deriv2[i] = sum2;
+					}
+				}
+
+				// Vertical 1D convolutions: LoG = g''(x) g(y) + g(x) g''(y), gradient = (g'(x) g(y), g(x) g'(y))
+				for (int j = 0; j < height; j++) {
+					float* dst = &response[j * bufferWidth];
+					float* grad2 = isGate ? &gradient2[j * bufferWidth] : NULL;
+
+					for (int i = 0; i < width; i++) {
+						float sumLoG = 0.0f, sumX = 0.0f, sumY = 0.0f;
+
+						for (int k = 0; k < size; k++) {
+							int index = (j + k) * bufferWidth + i;
+							sumLoG += g[k] * deriv2X[index] + g2[k] * smoothX[index];
+						}
+						if (isGate) {
+							for (int k = 0; k < size; k++) {
+								int index = (j + k) * bufferWidth + i;
+								sumX += g[k] * deriv1X[index];
+								sumY += g1[k] * smoothX[index];
+							}
+							grad2[i] = sumX * sumX + sumY * sumY;
+						}
+						dst[i] = sumLoG;
+					}
+				}
+
+				// Mark zero-crossings (comparing with left and upper neighbor)
+				for (int y = y0; y < y1; y++) {
+					int j = y - y0 + 1;
+					const float* upper = &response[(j - 1) * bufferWidth];
+					const float* center = &response[j * bufferWidth];
+					uchar* dstRow = edges.ptr<uchar>(y);
+
+					for (int x = x0; x < x1; x++) {
+						int i = x - x0 + 1;
+						bool isEdge = (x > 0) && isSignChange(center[i - 1], center[i]);
+						isEdge = isEdge || ((y > 0) && isSignChange(upper[i], center[i]));
+
+						if (isEdge && isGate)
+							isEdge = (gradient2[j * bufferWidth + i] >= minGradient2);
+
+						dstRow[x] = 255 * isEdge;
+					}
+
+					if (laplacian != NULL)
+						memcpy(laplacian->ptr<float>(y) + x0, &center[1], (x1 - x0) * sizeof(float));
+				}
+			}
+		});
+	}
+
+	/*! Detect edges as zero-crossings of the Laplacian of Gaussian (LoG) at multiple scales.
+	*
+	* Because of G(s2) = G(s1) * G(sqrt(s2^2 - s1^2)), the smoothed image of a scale is calculated from the
+	* smoothed image of the previous (smaller) scale by a smaller Gaussian. Then, a single fused pass per
+	* scale determines the Laplacian L4, the gradient magnitude (central differences), and zero-crossings.
+	* Alternatively, the difference of Gaussians (DoG) of subsequent scales is used, which is available at
+	* no additional cost. The smallest scale uses the original image as previous scale.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param edges [out] Edge images with values in {0, 255} (sorted by increasing scale)
+	* \param sigmas [in] Standard deviations of the Gaussians
+	* \param minGradient [in] Minimum gradient magnitude (gray-values per pixel) of edge pixels (0 to disable)
+	* \param isDifferenceOfGaussians [in] Use DoG of subsequent scales instead of Laplacian, if true
+	*/
+	void logZeroCrossingsMultiScale(const Mat& image, vector<Mat>& edges, vector<double> sigmas, double minGradient, bool isDifferenceOfGaussians) {
+		edges.clear();
+
+		// Check image type
+		if (image.type() != CV_8U)
+			return;
+
+		// Process scales in ascending order
+		sort(sigmas.begin(), sigmas.end());
+		bool isGate = (minGradient > 0.0);
+		float minGradient2 = (float)(4.0 * minGradient * minGradient);	// Central differences are 2 * gradient
+		double lastSigma = 0.0;
+		Mat smoothed, lastSmoothed;
+
+		image.convertTo(smoothed, CV_32F);
+
+		for (double sigma : sigmas) {
+			if (sigma <= lastSigma)
+				continue;
+
+			// Incremental smoothing of previous scale
+			double deltaSigma = sqrt(sigma * sigma - lastSigma * lastSigma);
+			swap(smoothed, lastSmoothed);
+			GaussianBlur(lastSmoothed, smoothed, Size(0, 0), deltaSigma, deltaSigma, BORDER_REPLICATE);
+			lastSigma = sigma;
+
+			// Fused Laplacian (or DoG), gradient, and zero-crossings on row bands in parallel
+			Mat scaleEdges(image.size(), CV_8U);
+			int rows = image.rows, cols = image.cols;
+
+			parallel_for_(Range(0, (rows + TILE_HEIGHT - 1) / TILE_HEIGHT), [&](const Range& range) {
+				vector<float> lastResponse(cols), thisResponse(cols);
+
+				// Filter response of one row (replicated border)
+				auto rowResponse = [&](int y, float* dst) {
+					const float* upper = smoothed.ptr<float>(std::max(y - 1, 0));
+					const float* center = smoothed.ptr<float>(y);
+					const float* lower = smoothed.ptr<float>(std::min(y + 1, rows - 1));
+
+					if (isDifferenceOfGaussians) {
+						const float* last = lastSmoothed.ptr<float>(y);
+						for (int x = 0; x < cols; x++)
+							dst[x] = center[x] - last[x];
+					}
+					else {
+						for (int x = 0; x < cols; x++) {
+							float left = center[std::max(x - 1, 0)];
+							float right = center[std::min(x + 1, cols - 1)];
+							dst[x] = left + right + upper[x] + lower[x] - 4.0f * center[x];
+						}
+					}
+				};
+
+				for (int band = range.start; band < range.end; band++) {
+					int y0 = band * TILE_HEIGHT;
+					int y1 = std::min(y0 + TILE_HEIGHT, rows);
+
+					rowResponse(std::max(y0 - 1, 0), lastResponse.data());
+
+					for (int y = y0; y < y1; y++) {
+						const float* upper = smoothed.ptr<float>(std::max(y - 1, 0));
+						const float* center = smoothed.ptr<float>(y);
+						const float* lower = smoothed.ptr<float>(std::min(y + 1, rows - 1));
+						uchar* dstRow = scaleEdges.ptr<uchar>(y);
+
+						rowResponse(y, thisResponse.data());
+
+						for (int x = 0; x < cols; x++) {
+							bool isEdge = (x > 0) && isSignChange(thisResponse[x - 1], thisResponse[x]);
+							isEdge = isEdge || ((y > 0) && isSignChange(lastResponse[x], thisResponse[x]));
+
+							if (isEdge && isGate) {
+								float gx = center[std::min(x + 1, cols - 1)] - center[std::max(x - 1, 0)];
+								float gy = lower[x] - upper[x];
+								isEdge = (gx * gx + gy * gy >= minGradient2);
+							}
+
+							dstRow[x] = 255 * isEdge;
+						}
+
+						swap(lastResponse, thisResponse);
+					}
+				}
+			});
+
+			edges.push_back(scaleEdges);
+		}
+	}
+}
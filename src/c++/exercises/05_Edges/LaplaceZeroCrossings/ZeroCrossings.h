@@ -0,0 +1,25 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_ZERO_CROSSINGS_H
+#define IP_ZERO_CROSSINGS_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Prototypes */
+	void logZeroCrossings(const cv::Mat& image, cv::Mat& edges, double sigma, double minGradient = 0.0, cv::Mat* laplacian = NULL);
+	void logZeroCrossingsMultiScale(const cv::Mat& image, std::vector<cv::Mat>& edges, std::vector<double> sigmas, double minGradient = 0.0, bool isDifferenceOfGaussians = false);
+}
+
+#endif /* IP_ZERO_CROSSINGS_H */
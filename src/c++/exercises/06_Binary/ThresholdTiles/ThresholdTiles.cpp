@@ -5,7 +5,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.11.25
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -73,7 +73,7 @@ void onTrackbarNumberTiles(int numberTiles, void* imagePtr) {
 
 /*! Locally adaptive thresholding of image tiles.
 * 
-* Sets threshold to tau = (max_value - min_value) / 2 for each tile.
+* Sets threshold to the mid-range tau = (max_value + min_value) / 2 for each tile.
 * 
 * \param image [in] Source image
 * \param binary [out] Processed binary image after thresholding
@@ -97,7 +97,7 @@ void thresholdTiles(const Mat& image, Mat& binary, int numberTiles) {
 			// Determine threshold
 			double minValue, maxValue, tau;
 			minMaxLoc(srcImage, &minValue, &maxValue);
-			tau = 0.5 * (maxValue - minValue);
+			tau = 0.5 * (maxValue + minValue);
 
 			// Apply threshold
 			threshold(srcImage, dstImage, tau, 255, THRESH_BINARY);
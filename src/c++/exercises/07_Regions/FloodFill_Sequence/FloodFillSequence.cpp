@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.11.30
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -12,7 +12,9 @@
 #define _CRT_SECURE_NO_WARNINGS		// Enable getenv()
 
 /* Include files */
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <opencv2/opencv.hpp>
 
 /* Defines */
@@ -86,9 +88,10 @@ void displayFillRegions(Mat& binImage) {
 	}
 }
 
-/*! Fills binary object using flood fill.
+/*! Fills binary object using scanline flood fill.
 *
-* - The implemtation uses a breadth-first approach with N4 neighborhood.
+* - The implementation fills horizontal runs ("spans") of pixels at once with N4 neighborhood.
+*   Only the ranges of the rows above and below a span are pushed to a stack as seeds.
 * - Unlabeled pixels are supposed to have the value 127.
 * - Regions are filled with the value 255.
 * - The progress is displayed using imshow().
@@ -99,33 +102,46 @@ void displayFillRegions(Mat& binImage) {
 * \param displaySteps [in] Update the display every displaySteps pixels, used to control speed
 */
 void displayFloodFill(Mat& binImage, int x, int y, int displaySteps) {
-	queue<Point> q;
+	typedef struct seedSpan { int y, x0, x1; } seedSpan;
+	vector<seedSpan> stack;
 	bool isDisplay = true;
-	unsigned displayCounter = 0;
-
-	// Init queue with first pixel location of BLOB
-	q.push(Point(x, y));
-
-	// Process queue
-	while (!q.empty()) {
-		// Get and remove next pixel location
-		x = q.front().x;
-		y = q.front().y;
-		q.pop();
-
-		// Is pixel new BLOB pixel?
-		if ((x >= 0) && (x < binImage.cols) && (y >= 0) && (y < binImage.rows) && binImage.at<uchar>(y, x) == 127) {
-			// Mark as BLOB pixel
-			binImage.at<uchar>(y, x) = 255;
-
-			// Add 4-neighbors to queue
-			q.push(cv::Point(x + 1, y));
-			q.push(cv::Point(x, y + 1));
-			q.push(cv::Point(x, y - 1));
-			q.push(cv::Point(x - 1, y));
+	int displayCounter = 0;
+
+	// Init stack with first pixel location of BLOB
+	stack.reserve(2 * binImage.rows + 2);
+	stack.push_back({ y, x, x });
+
+	// Process stack
+	while (!stack.empty()) {
+		// Get and remove next seed
+		seedSpan seed = stack.back();
+		stack.pop_back();
+		uchar* row = binImage.ptr<uchar>(seed.y);
+
+		for (int xs = seed.x0; xs <= seed.x1; xs++) {
+			// Is pixel new BLOB pixel?
+			if (row[xs] != 127)
+				continue;
+
+			// Extend span to the left and right and mark as BLOB pixels
+			int left = xs, right = xs;
+			while ((left > 0) && (row[left - 1] == 127))
+				left--;
+			while ((right < binImage.cols - 1) && (row[right + 1] == 127))
+				right++;
+			std::fill(row + left, row + right + 1, 255);
+
+			// Add ranges of rows above and below to stack
+			if (seed.y > 0)
+				stack.push_back({ seed.y - 1, left, right });
+			if (seed.y < binImage.rows - 1)
+				stack.push_back({ seed.y + 1, left, right });
+			xs = right + 1;
 
 			// Display progress
-			if (isDisplay && (++displayCounter % 10 == 0)) {
+			displayCounter += right - left + 1;
+			if (isDisplay && (displayCounter >= displaySteps)) {
+				displayCounter = 0;
 				imshow("Flood fill (Press <Enter> to skip region)", binImage);
 				if (waitKey(1) > 0)
 					isDisplay = false;
@@ -0,0 +1,272 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Compiler settings */
+#define _USE_MATH_DEFINES
+
+/* Include files */
+#include "HoughCircle.h"
+#include "HoughLine.h"
+#include <algorithm>
+#include <cmath>
+#include <opencv2/opencv.hpp>
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip {
+
+	/* Edge pixel with normalized gradient direction */
+	typedef struct edgePixel {
+		int x, y;
+		float dx, dy;
+	} edgePixel;
+
+	/* Prototypes (module internal) */
+	static void voteAlongRay(Mat& accumulator, const edgePixel& edge, float sign, int minRadius, int maxRadius, int rowStart, int rowEnd);
+
+	/*! Detect circles using the gradient-based Hough transform.
+	*
+	* Reference: H. K. Yuen, J. Princen, J. Illingworth, J. Kittler: Comparative study of Hough
+	* transform methods for circle finding, Image and Vision Computing 8(1), 1990, pp. 71-77.
+	*
+	* The 3D parameter space (x, y, r) is split into two steps:
+	* 1. Each edge pixel votes once along its gradient direction (both signs): The ray segment with
+	*    distances [minRadius, maxRadius] is rasterized into a 2D center accumulator of the image size
+	*    instead of drawing a circle for each possible radius. Bands of accumulator rows are processed
+	*    in parallel, each band voting only into its own rows of the shared accumulator.
+	* 2. Peaks in the center accumulator are found with findHoughPeaks() (as for lines). For each
+	*    center, the radius is the maximum of a 1D histogram of distances to nearby edge pixels whose
+	*    gradients point towards (or away from) the center.
+	*
+	* \param image [in] Source image (type CV_8U)
+	* \param circles [out] Detected circles sorted by decreasing center votes
+	* \param edgeThreshold [in] Minimum gradient magnitude (3x3 Sobel) of edge pixels
+	* \param minRadius [in] Minimum circle radius
+	* \param maxRadius [in] Maximum circle radius
+	* \param centerThreshold [in] Minimum number of votes for a circle center
+	* \param minDistance [in] Minimum distance between centers of detected circles
+	* \param centerSpace [out] Center accumulator (type CV_32S) or NULL
+	*/
+	void houghCircleTransform(const Mat& image, vector<houghCircle>& circles, int edgeThreshold, int minRadius, int maxRadius,
+		double centerThreshold, int minDistance, Mat* centerSpace) {
+		const double MIN_DIRECTION_COSINE = 0.9;	// Gradient must point to center within about 25 degrees
+		const double MIN_CIRCUMFERENCE_RATIO = 0.3;	// Minimum fraction of circumference covered by edge pixels
+
+		circles.clear();
+
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || (minRadius < 1) || (maxRadius < minRadius))
+			return;
+
+		// Gradient images
+		Mat gradX, gradY;
+		Sobel(image, gradX, CV_16S, 1, 0, 3);
+		Sobel(image, gradY, CV_16S, 0, 1, 3);
+
+		// Collect edge pixels (parallel over image stripes, concatenated in row order)
+		int numberStripes = std::max(1, std::min(getNumThreads(), image.rows));
+		vector<vector<edgePixel>> stripeEdges(numberStripes);
+		int edgeThreshold2 = edgeThreshold * edgeThreshold;
+
+		parallel_for_(Range(0, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				vector<edgePixel>& edges = stripeEdges[stripe];
+				int y0 = stripe * image.rows / numberStripes;
+				int y1 = (stripe + 1) * image.rows / numberStripes;
+
+				for (int y = y0; y < y1; y++) {
+					const short* rowX = gradX.ptr<short>(y);
+					const short* rowY = gradY.ptr<short>(y);
+
+					for (int x = 0; x < image.cols; x++) {
+						int gx = rowX[x];
+						int gy = rowY[x];
+						int magnitude2 = gx * gx + gy * gy;
+
+						if ((magnitude2 == 0) || (magnitude2 < edgeThreshold2))
+							continue;
+
+						// Normalized gradient direction
+						double magnitude = sqrt((double)magnitude2);
+						edgePixel edge = { x, y, (float)(gx / magnitude), (float)(gy / magnitude) };
+						edges.push_back(edge);
+					}
+				}
+			}
+		});
+
+		vector<edgePixel> edges;
+		vector<int> rowStart(image.rows + 1, 0);	// Index of first edge pixel in each row
+
+		for (const vector<edgePixel>& stripe : stripeEdges)
+			edges.insert(edges.end(), stripe.begin(), stripe.end());
+		for (const edgePixel& edge : edges)
+			rowStart[edge.y + 1]++;
+		for (int y = 0; y < image.rows; y++)
+			rowStart[y + 1] += rowStart[y];
+
+		// Vote for centers (parallel over bands of accumulator rows, each written by one thread only)
+		Mat accumulator = Mat::zeros(image.size(), CV_32S);
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			int first = rowStart[std::max(range.start - maxRadius, 0)];
+			int last = rowStart[std::min(range.end + maxRadius, image.rows)];
+
+			for (int i = first; i < last; i++) {
+				voteAlongRay(accumulator, edges[i], 1.0f, minRadius, maxRadius, range.start, range.end);
+				voteAlongRay(accumulator, edges[i], -1.0f, minRadius, maxRadius, range.start, range.end);
+			}
+		});
+
+		// Sort edge pixels into grid cells of size maxRadius (to find pixels near a center quickly)
+		int cellSize = maxRadius;
+		int gridCols = (image.cols + cellSize - 1) / cellSize;
+		int gridRows = (image.rows + cellSize - 1) / cellSize;
+		vector<int> cellStart(gridCols * gridRows + 1, 0);
+
+		for (const edgePixel& edge : edges)
+			cellStart[(edge.y / cellSize) * gridCols + edge.x / cellSize + 1]++;
+		for (size_t cell = 1; cell < cellStart.size(); cell++)
+			cellStart[cell] += cellStart[cell - 1];
+
+		vector<edgePixel> gridEdges(edges.size());
+		vector<int> cellFill(cellStart.begin(), cellStart.end() - 1);
+
+		for (const edgePixel& edge : edges)
+			gridEdges[cellFill[(edge.y / cellSize) * gridCols + edge.x / cellSize]++] = edge;
+
+		// Find center candidates
+		vector<Point> centers;
+		findHoughPeaks(accumulator, centers, centerThreshold, minDistance, INT_MAX);
+
+		// Estimate radius for each center by 1D radius histogram
+		vector<int> histogram(maxRadius + 2);
+
+		for (const Point& center : centers) {
+			std::fill(histogram.begin(), histogram.end(), 0);
+
+			int cellX = center.x / cellSize;
+			int cellY = center.y / cellSize;
+
+			for (int gy = std::max(cellY - 1, 0); gy <= std::min(cellY + 1, gridRows - 1); gy++) {
+				for (int gx = std::max(cellX - 1, 0); gx <= std::min(cellX + 1, gridCols - 1); gx++) {
+					int cell = gy * gridCols + gx;
+
+					for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+						const edgePixel& edge = gridEdges[i];
+						double dx = edge.x - center.x;
+						double dy = edge.y - center.y;
+						double distance = sqrt(dx * dx + dy * dy);
+
+						if ((distance < minRadius - 0.5) || (distance > maxRadius + 0.5))
+							continue;
+						if (fabs(dx * edge.dx + dy * edge.dy) < MIN_DIRECTION_COSINE * distance)
+							continue;
+
+						histogram[cvRound(distance)]++;
+					}
+				}
+			}
+
+			// Radius with best support relative to circumference (using 3 bins to cope with discretization)
+			int bestRadius = 0, bestVotes = 0;
+			double bestScore = 0.0;
+
+			for (int r = minRadius; r <= maxRadius; r++) {
+				int votes = histogram[r - 1] + histogram[r] + histogram[r + 1];
+				double score = votes / (2.0 * M_PI * r);
+
+				if (score > bestScore) {
+					bestScore = score;
+					bestRadius = r;
+					bestVotes = votes;
+				}
+			}
+
+			if (bestScore >= MIN_CIRCUMFERENCE_RATIO) {
+				houghCircle circle;
+				circle.center = center;
+				circle.radius = bestRadius;
+				circle.votes = bestVotes;
+				circles.push_back(circle);
+			}
+		}
+
+		// Return accumulator
+		if (centerSpace != NULL)
+			*centerSpace = accumulator;
+	}
+
+	/*! Vote for all centers on a ray segment starting at an edge pixel.
+	*
+	* The segment with distances [minRadius, maxRadius] from the edge pixel is rasterized by a DDA
+	* with integer offsets k along its major axis, so that each cell on the segment receives one
+	* vote. Only cells in the rows [rowStart, rowEnd) are incremented.
+	*
+	* \param accumulator [in/out] Center accumulator (type CV_32S)
+	* \param edge [in] Edge pixel with normalized gradient direction
+	* \param sign [in] Direction of ray (1: along gradient, -1: against gradient)
+	* \param minRadius [in] Minimum circle radius
+	* \param maxRadius [in] Maximum circle radius
+	* \param rowStart [in] First accumulator row to vote into
+	* \param rowEnd [in] Accumulator row following the last row to vote into
+	*/
+	static void voteAlongRay(Mat& accumulator, const edgePixel& edge, float sign, int minRadius, int maxRadius, int rowStart, int rowEnd) {
+		// Steps of one pixel along major axis (offset k along major axis corresponds to distance k / major)
+		float dirX = sign * edge.dx, dirY = sign * edge.dy;
+		float major = std::max(fabs(dirX), fabs(dirY));
+		float stepX = dirX / major, stepY = dirY / major;
+		int first = (int)ceil(minRadius * major), last = (int)floor(maxRadius * major);
+
+		// Restrict steps to rows [rowStart, rowEnd)
+		if (fabs(stepY) > 1.0e-6f) {
+			float k0 = (rowStart - 0.5f - edge.y) / stepY;
+			float k1 = (rowEnd - 0.5f - edge.y) / stepY;
+			if (k0 > k1)
+				std::swap(k0, k1);
+			first = std::max(first, (int)floor(std::max(k0, first - 1.0f)));
+			last = std::min(last, (int)ceil(std::min(k1, last + 1.0f)));
+		}
+		else if ((edge.y < rowStart) || (edge.y >= rowEnd))
+			return;
+
+		// Vote
+		for (int k = first; k <= last; k++) {
+			int cx = edge.x + cvRound(k * stepX);
+			int cy = edge.y + cvRound(k * stepY);
+
+			if ((cy >= rowStart) && (cy < rowEnd) && (cx >= 0) && (cx < accumulator.cols))
+				accumulator.at<int>(cy, cx)++;
+		}
+	}
+
+	/*! Draw circles and their centers on an image.
+	*
+	* \param image Image to draw circles on (converted to BGR, if grayscale)
+	* \param circles Circles to draw
+	*/
+	void drawCircles(Mat& image, const vector<houghCircle>& circles) {
+		// Check image type
+		if (image.type() == CV_8U)
+			cvtColor(image, image, COLOR_GRAY2BGR);
+		if (image.type() != CV_8UC3)
+			return;
+
+		// Draw circles
+		Scalar color(0, 0, 255);
+
+		for (const houghCircle& c : circles) {
+			circle(image, c.center, c.radius, color, 2);
+			circle(image, c.center, 2, color, -1);
+		}
+	}
+}
@@ -0,0 +1,33 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_HOUGH_CIRCLE_H
+#define IP_HOUGH_CIRCLE_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Circle data type */
+	typedef struct houghCircle {
+		cv::Point center;
+		int radius = 0;
+		int votes = 0;				// Edge pixels supporting the radius
+	} houghCircle;
+
+	/* Prototypes */
+	void houghCircleTransform(const cv::Mat& image, std::vector<houghCircle>& circles, int edgeThreshold, int minRadius, int maxRadius,
+		double centerThreshold, int minDistance, cv::Mat* centerSpace = NULL);
+	void drawCircles(cv::Mat& image, const std::vector<houghCircle>& circles);
+}
+
+#endif /* IP_HOUGH_CIRCLE_H */
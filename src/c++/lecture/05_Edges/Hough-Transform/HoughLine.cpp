@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.27
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -14,9 +14,11 @@
 /* Include files */
 #include "HoughLine.h"
 #include <cmath>
+#include <algorithm>
 #include <opencv2/opencv.hpp>
 
 /* Namespaces */
+using namespace std;
 using namespace cv;
 
 namespace ip {
@@ -88,6 +90,256 @@ namespace ip {
 		delete[] sinLUT;
 	}
 
+	/*! Detect line segments using the progressive probabilistic Hough transform.
+	*
+	* Reference: J. Matas, C. Galambos, J. Kittler: Robust Detection of Lines Using the Progressive
+	* Probabilistic Hough Transform, Computer Vision and Image Understanding 78, 2000, pp. 119-137.
+	*
+	* Edge pixels vote in random order. As soon as the bin a pixel voted for reaches the threshold,
+	* the corresponding segment is traced along the edge image, and its pixels are removed from the
+	* pool of edge pixels (including their votes). Hence, the effort depends on the number of lines
+	* rather than on the total number of edge pixels.
+	*
+	* The Hough space geometry is the same as for houghTransform().
+	*
+	* \param edgeImage [in] Source edge image (with edge pixels marked by value 255)
+	* \param segments [out] Detected line segments with end points and number of votes
+	* \param threshold [in] Minimum number of votes to accept a line
+	* \param minLength [in] Minimum length of a segment in pixels (shorter segments are discarded)
+	* \param maxGap [in] Maximum number of consecutive non-edge pixels bridged while tracing a segment
+	* \param height [in] Number of bins of the r axis
+	* \param width [in] Number of bins of the theta axis (covering [0, pi])
+	*/
+	void houghProbabilistic(const Mat& edgeImage, vector<lineSegment>& segments, int threshold, int minLength, int maxGap, int height, int width) {
+		// Pixel states in pool
+		const uchar NOT_IN_POOL = 0;
+		const uchar NOT_VOTED = 1;
+		const uchar VOTED = 2;
+
+		segments.clear();
+
+		// Check image type
+		if (edgeImage.type() != CV_8U)
+			return;
+
+		// Edge image geometry (source)
+		Point imgCenter(edgeImage.cols / 2, edgeImage.rows / 2);
+
+		// Hough space geometry (same as in houghTransform())
+		double deltaTheta = M_PI / (double)width;
+		double deltaRadius = sqrt(edgeImage.cols * edgeImage.cols + edgeImage.rows * edgeImage.rows) / height;
+		int v0 = height / 2;
+
+		// Pre-calc LUTs for speedup
+		vector<double> cosLUT(width), sinLUT(width);
+
+		for (int u = 0; u < width; u++) {
+			double theta = deltaTheta * u;
+			cosLUT[u] = cos(theta);
+			sinLUT[u] = sin(theta);
+		}
+
+		// Collect pool of edge pixels
+		Mat pool = Mat::zeros(edgeImage.size(), CV_8U);
+		vector<Point> edgePixels;
+
+		for (int y = 0; y < edgeImage.rows; y++) {
+			const uchar* srcRow = edgeImage.ptr<uchar>(y);
+			uchar* poolRow = pool.ptr<uchar>(y);
+
+			for (int x = 0; x < edgeImage.cols; x++) {
+				if (srcRow[x] == 255) {
+					poolRow[x] = NOT_VOTED;
+					edgePixels.push_back(Point(x, y));
+				}
+			}
+		}
+
+		// Accumulator (r in rows, theta in columns)
+		vector<int> accumulator((size_t)height * width, 0);
+
+		// Add (+1) or remove (-1) votes of a pixel and return the bin with most votes
+		auto vote = [&](Point p, int increment, int& maxVotes) {
+			int xc = p.x - imgCenter.x;
+			int yc = p.y - imgCenter.y;
+			int maxU = 0;
+
+			maxVotes = 0;
+			for (int u = 0; u < width; u++) {
+				double r = xc * cosLUT[u] + yc * sinLUT[u];
+				int v = v0 + (int)(r / deltaRadius + 0.5);
+				int& votes = accumulator[(size_t)v * width + u];
+
+				votes += increment;
+				if (votes > maxVotes) {
+					maxVotes = votes;
+					maxU = u;
+				}
+			}
+			return maxU;
+		};
+
+		// Reproducible random order of edge pixels
+		RNG rng(0xFFFFFFFF);
+
+		for (int remaining = (int)edgePixels.size(); remaining > 0; remaining--) {
+			// Draw random pixel from remaining pixels
+			int index = rng.uniform(0, remaining);
+			Point p = edgePixels[index];
+			edgePixels[index] = edgePixels[remaining - 1];
+
+			// Pixel removed from pool by a previously detected segment?
+			if (pool.at<uchar>(p) != NOT_VOTED)
+				continue;
+
+			// Vote for all lines through pixel
+			int maxVotes;
+			int u = vote(p, 1, maxVotes);
+			pool.at<uchar>(p) = VOTED;
+
+			if (maxVotes < threshold)
+				continue;
+
+			// Direction of line (perpendicular to normal (cos, sin)) stepping one pixel along the major axis
+			double dx = -sinLUT[u];
+			double dy = cosLUT[u];
+			bool isMajorX = fabs(dx) > fabs(dy);
+			double stepX = isMajorX ? ((dx > 0.0) ? 1.0 : -1.0) : dx / fabs(dy);
+			double stepY = isMajorX ? dy / fabs(dx) : ((dy > 0.0) ? 1.0 : -1.0);
+
+			// Trace segment from pixel in both directions, bridging gaps up to maxGap
+			Point ends[2] = { p, p };
+
+			for (int k = 0; k < 2; k++) {
+				double sign = (k == 0) ? 1.0 : -1.0;
+				double x = p.x, y = p.y;
+
+				for (int gap = 0; gap <= maxGap; ) {
+					x += sign * stepX;
+					y += sign * stepY;
+					int ix = cvRound(x);
+					int iy = cvRound(y);
+
+					if ((ix < 0) || (ix >= edgeImage.cols) || (iy < 0) || (iy >= edgeImage.rows))
+						break;
+
+					if (pool.at<uchar>(iy, ix) != NOT_IN_POOL) {
+						ends[k] = Point(ix, iy);
+						gap = 0;
+					}
+					else
+						gap++;
+				}
+			}
+
+			// Remove segment pixels from pool and their votes from the accumulator.
+			// Neighbors across the line are removed as well to cope with edges wider than one pixel.
+			int lengthX = abs(ends[1].x - ends[0].x);
+			int lengthY = abs(ends[1].y - ends[0].y);
+			int steps = std::max(lengthX, lengthY);
+			double x = ends[1].x, y = ends[1].y;
+			double stepToEndX = (steps > 0) ? (ends[0].x - ends[1].x) / (double)steps : 0.0;
+			double stepToEndY = (steps > 0) ? (ends[0].y - ends[1].y) / (double)steps : 0.0;
+
+			for (int i = 0; i <= steps; i++, x += stepToEndX, y += stepToEndY) {
+				for (int across = -1; across <= 1; across++) {
+					int ix = cvRound(x) + (isMajorX ? 0 : across);
+					int iy = cvRound(y) + (isMajorX ? across : 0);
+
+					if ((ix < 0) || (ix >= edgeImage.cols) || (iy < 0) || (iy >= edgeImage.rows))
+						continue;
+
+					uchar& state = pool.at<uchar>(iy, ix);
+					if (state == VOTED) {
+						int votesNotUsed;
+						vote(Point(ix, iy), -1, votesNotUsed);
+					}
+					state = NOT_IN_POOL;
+				}
+			}
+
+			// Store segment if long enough
+			if (steps >= minLength) {
+				lineSegment segment;
+				segment.p0 = ends[1];
+				segment.p1 = ends[0];
+				segment.votes = maxVotes;
+				segments.push_back(segment);
+			}
+		}
+	}
+
+	/*! Find local maxima in a Hough space using non-maximum suppression.
+	*
+	* Candidates are values greater than or equal to the threshold and to all of their 8 neighbors.
+	* Candidates are accepted in order of decreasing votes, and a candidate is suppressed if it is
+	* located within minDistance of an accepted peak.
+	*
+	* The function is used for lines (r/theta space) and circles (center space) alike.
+	*
+	* \param houghSpace [in] Accumulator (single channel of any depth)
+	* \param peaks [out] Locations of peaks sorted by decreasing value
+	* \param threshold [in] Minimum value of a peak
+	* \param minDistance [in] Minimum distance between two peaks
+	* \param maxPeaks [in] Maximum number of peaks to return
+	*/
+	void findHoughPeaks(const Mat& houghSpace, vector<Point>& peaks, double threshold, int minDistance, int maxPeaks) {
+		peaks.clear();
+
+		// Check image type
+		if (houghSpace.empty() || (houghSpace.channels() != 1))
+			return;
+
+		// Work on 32-bit floating point copy
+		Mat space;
+		houghSpace.convertTo(space, CV_32F);
+
+		// Collect local maxima (3x3) above threshold
+		vector<pair<float, Point>> candidates;
+
+		for (int y = 0; y < space.rows; y++) {
+			const float* lastRow = space.ptr<float>(std::max(y - 1, 0));
+			const float* row = space.ptr<float>(y);
+			const float* nextRow = space.ptr<float>(std::min(y + 1, space.rows - 1));
+
+			for (int x = 0; x < space.cols; x++) {
+				float value = row[x];
+
+				if (value < threshold)
+					continue;
+
+				int x0 = std::max(x - 1, 0);
+				int x1 = std::min(x + 1, space.cols - 1);
+				bool isMax = true;
+
+				for (int u = x0; (u <= x1) && isMax; u++)
+					isMax = (lastRow[u] <= value) && (row[u] <= value) && (nextRow[u] <= value);
+
+				if (isMax)
+					candidates.push_back(make_pair(value, Point(x, y)));
+			}
+		}
+
+		// Accept strongest candidates not too close to stronger peaks
+		stable_sort(candidates.begin(), candidates.end(),
+			[](const pair<float, Point>& a, const pair<float, Point>& b) { return a.first > b.first; });
+		int minDistance2 = minDistance * minDistance;
+
+		for (size_t i = 0; (i < candidates.size()) && ((int)peaks.size() < maxPeaks); i++) {
+			Point p = candidates[i].second;
+			bool isSuppressed = false;
+
+			for (size_t k = 0; (k < peaks.size()) && !isSuppressed; k++) {
+				int dx = p.x - peaks[k].x;
+				int dy = p.y - peaks[k].y;
+				isSuppressed = (dx * dx + dy * dy < minDistance2);
+			}
+
+			if (!isSuppressed)
+				peaks.push_back(p);
+		}
+	}
+
 	/*! Calculate parameters of line corresponding to a specific point in the Hough space.
 	* 
 	* \param imgSize Edge image size
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -17,8 +17,17 @@
 
 namespace ip
 {
+	/* Line segment data type */
+	typedef struct lineSegment {
+		cv::Point p0;				// End points
+		cv::Point p1;
+		int votes = 0;				// Votes in Hough space when detected
+	} lineSegment;
+
 	/* Prototypes */
 	void houghTransform(const cv::Mat& edgeImage, cv::Mat& houghSpace, int height = 361, int width = 360);
+	void houghProbabilistic(const cv::Mat& edgeImage, std::vector<lineSegment>& segments, int threshold, int minLength = 30, int maxGap = 3, int height = 361, int width = 360);
+	void findHoughPeaks(const cv::Mat& houghSpace, std::vector<cv::Point>& peaks, double threshold, int minDistance = 10, int maxPeaks = 10);
 	void houghSpaceToLine(cv::Size imgSize, cv::Size houghSize, int x, int y, double& r, double& theta);
 	void drawLine(cv::Mat& image, double r, double theta);
 	void drawHoughLineLabels(cv::Mat& houghSpace);
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.27
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -16,12 +16,25 @@
 #include <opencv2/opencv.hpp>
 #include "Sobel.h"
 #include "HoughLine.h"
+#include "HoughCircle.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")			// Read environment variable ImagingData
 #define INPUT_IMAGE_RELATIVE_PATH "/images/misc/Docks.jpg"	// Image file including relative path
 #define EDGE_IMAGE_THRESHOLD 25
 #define SMOOTHING_KERNEL_SIZE 1
+#define NUMBER_LINES 1
+#define PEAKS_MIN_DISTANCE 10
+#define SEGMENT_VOTES_THRESHOLD 80
+#define SEGMENT_MIN_LENGTH 50
+#define SEGMENT_MAX_GAP 3
+
+#define CIRCLE_IMAGE_RELATIVE_PATH "/images/dice/1.jpg"	// Image file for circle detection
+#define CIRCLE_EDGE_THRESHOLD 200
+#define CIRCLE_MIN_RADIUS 5
+#define CIRCLE_MAX_RADIUS 40
+#define CIRCLE_CENTER_THRESHOLD 26
+#define CIRCLE_MIN_DISTANCE 15
 #define IS_WRITE_IMAGES false
 
 /* Namespaces */
@@ -50,34 +63,68 @@ int main()
 	Mat houghSpace;
 	houghTransform(edgeImage, houghSpace);
 
-	// Find global maximum in Hough space ...
-	Point houghMaxLocation;
+	// Find maxima in Hough space ...
+	vector<Point> houghPeaks;
 	GaussianBlur(houghSpace, houghSpace, Size(SMOOTHING_KERNEL_SIZE, SMOOTHING_KERNEL_SIZE), 0.0);
-	minMaxLoc(houghSpace, NULL, NULL, NULL, &houghMaxLocation);
+	findHoughPeaks(houghSpace, houghPeaks, 0.0, PEAKS_MIN_DISTANCE, NUMBER_LINES);
+
+	// ... and draw corresponding lines in original image
+	for (const Point& peak : houghPeaks) {
+		double r, theta;
+		houghSpaceToLine(
+			Size(edgeImage.cols, edgeImage.rows),
+			Size(houghSpace.cols, houghSpace.rows),
+			peak.x, peak.y, r, theta);
+		drawLine(image, r, theta);
+	}
+
+	// Detect line segments using the progressive probabilistic Hough transform
+	vector<lineSegment> segments;
+	Mat segmentsImage;
+	houghProbabilistic(edgeImage, segments, SEGMENT_VOTES_THRESHOLD, SEGMENT_MIN_LENGTH, SEGMENT_MAX_GAP);
+	cvtColor(edgeImage, segmentsImage, COLOR_GRAY2BGR);
+	for (const lineSegment& segment : segments)
+		line(segmentsImage, segment.p0, segment.p1, Scalar(0, 0, 255), 2);
 
-	// ... and draw corresponding line in original image
-	double r, theta;
-	houghSpaceToLine(
-		Size(edgeImage.cols, edgeImage.rows),
-		Size(houghSpace.cols, houghSpace.rows),
-		houghMaxLocation.x, houghMaxLocation.y, r, theta);
-	drawLine(image, r, theta);
+	// Detect circles (e.g., pips of dice) using the gradient-based Hough transform
+	string circleImagePath = string(IMAGE_DATA_PATH).append(CIRCLE_IMAGE_RELATIVE_PATH);
+	Mat circleImage = imread(circleImagePath, IMREAD_GRAYSCALE);
+	Mat centerSpace;
+
+	if (!circleImage.empty()) {
+		vector<houghCircle> circles;
+		houghCircleTransform(circleImage, circles, CIRCLE_EDGE_THRESHOLD, CIRCLE_MIN_RADIUS, CIRCLE_MAX_RADIUS,
+			CIRCLE_CENTER_THRESHOLD, CIRCLE_MIN_DISTANCE, &centerSpace);
+		drawCircles(circleImage, circles);
+
+		double maxValue;
+		minMaxLoc(centerSpace, NULL, &maxValue);
+		centerSpace.convertTo(centerSpace, CV_8U, 255.0 / std::max(maxValue, 1.0));
+	}
 
 	// Prepare Hough space image for display
 	houghSpace = 255 - houghSpace;										// Invert
 	drawHoughLineLabels(houghSpace);									// Axes
-	circle(houghSpace, houghMaxLocation, 10, Scalar(0, 0, 255), 2);		// Global maximum
+	for (const Point& peak : houghPeaks)
+		circle(houghSpace, peak, 10, Scalar(0, 0, 255), 2);				// Maxima
 
 	// Display image in named window
 	imshow("Image", image);
 	imshow("Edge image", edgeImage);
 	imshow("Hough transform", houghSpace);
+	imshow("Line segments (probabilistic)", segmentsImage);
+	if (!circleImage.empty()) {
+		imshow("Circles", circleImage);
+		imshow("Hough transform (circle centers)", centerSpace);
+	}
 
 	// Write images to file
 	if (IS_WRITE_IMAGES) {
 		imwrite("D:/_HoughLine.jpg", image);
 		imwrite("D:/_HoughEdge.jpg", edgeImage);
 		imwrite("D:/_HoughSpace.jpg", houghSpace);
+		imwrite("D:/_HoughSegments.jpg", segmentsImage);
+		imwrite("D:/_HoughCircles.jpg", circleImage);
 	}
 
 	// Wait for keypress and terminate
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.11.25
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -16,6 +16,9 @@
 #include <opencv2/opencv.hpp>
 #include "Histogram.h"
 #include "Thresholding.h"
+#include "Morphology.h"
+#include "MorphologyGraph.h"
+#include "Skeleton.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")				// Read environment variable ImagingData
@@ -39,6 +42,8 @@ void processAndDisplay(uchar thresh, int morphSize);
 string windowNameThreshold;
 Mat histogramImage;
 Mat image, binImageThresh, binEroded, binDilated, binClosed, binOpened, binClosedOpened, binOpenedClosed;
+Mat distancesToBackground, distancesToForeground, binErodedDisk, binDilatedDisk, binSkeleton;
+ip::MorphologyGraph morphGraph;
 
 /* Main function */
 int main()
@@ -114,20 +119,38 @@ void processAndDisplay(uchar thresh, int morphSize) {
 	if (thresh != lastThresh) {
 		ip::threshold(image, binImageThresh, thresh, IS_INVERT_BINARY_IMAGE);
 		imshow(windowNameThreshold, binImageThresh);
+
+		// Input of morphology graph (invalidates cached results)
+		morphGraph.setInput(binImageThresh);
+
+		// Distance maps for disk-shaped structure elements of any size
+		ip::squaredDistanceTransform(binImageThresh, distancesToBackground, false);
+		ip::squaredDistanceTransform(binImageThresh, distancesToForeground, true);
 	}
 
 	// Apply morphological operations (dilate, erode, close, open) and update image displays
 	if ((thresh != lastThresh) || (morphSize != lastMorphSize)) {
 		// Apply operations
 		if (morphSize >= 1) {
-			Mat structure = getStructuringElement(MORPH_RECT, Size(morphSize, morphSize));
-
-			dilate(binImageThresh, binDilated, structure);
-			erode(binImageThresh, binEroded, structure);
-			morphologyEx(binImageThresh, binClosed, MORPH_CLOSE, structure);
-			morphologyEx(binImageThresh, binOpened, MORPH_OPEN, structure);
-			morphologyEx(binClosed, binClosedOpened, MORPH_OPEN, structure);
-			morphologyEx(binOpened, binOpenedClosed, MORPH_CLOSE, structure);
+			// Build expression graph (shared subexpressions, e.g., dilated image in closing, are computed once)
+			ip::structureElement structure;
+			structure.size = morphSize;
+
+			int dilated = morphGraph.dilate(ip::MorphologyGraph::INPUT, structure);
+			int eroded = morphGraph.erode(ip::MorphologyGraph::INPUT, structure);
+			int closed = morphGraph.close(ip::MorphologyGraph::INPUT, structure);
+			int opened = morphGraph.open(ip::MorphologyGraph::INPUT, structure);
+			int closedOpened = morphGraph.open(closed, structure);
+			int openedClosed = morphGraph.close(opened, structure);
+
+			// Evaluate (results for other sizes remain cached until threshold changes)
+			morphGraph.evaluate({ dilated, eroded, closed, opened, closedOpened, openedClosed });
+			morphGraph.getResult(dilated, binDilated);
+			morphGraph.getResult(eroded, binEroded);
+			morphGraph.getResult(closed, binClosed);
+			morphGraph.getResult(opened, binOpened);
+			morphGraph.getResult(closedOpened, binClosedOpened);
+			morphGraph.getResult(openedClosed, binOpenedClosed);
 		}
 		else {
 			binDilated = binImageThresh.clone();
@@ -138,6 +161,14 @@ void processAndDisplay(uchar thresh, int morphSize) {
 			binOpenedClosed = binImageThresh.clone();
 		}
 
+		// Disk-shaped structure elements (threshold distance maps)
+		double radius = 0.5 * (morphSize - 1);
+		ip::thresholdDistances(distancesToBackground, binErodedDisk, radius);
+		ip::thresholdDistances(distancesToForeground, binDilatedDisk, radius, true);
+
+		// Skeleton of closed and opened regions
+		ip::skeletonize(binClosedOpened, binSkeleton);
+
 		// Update image displays
 		imshow("Dilated", binDilated);
 		imshow("Eroded", binEroded);
@@ -145,6 +176,9 @@ void processAndDisplay(uchar thresh, int morphSize) {
 		imshow("Opened", binOpened);
 		imshow("Closed / opened", binClosedOpened);
 		imshow("Opened / closed", binOpenedClosed);
+		imshow("Dilated (disk)", binDilatedDisk);
+		imshow("Eroded (disk)", binErodedDisk);
+		imshow("Skeleton (closed / opened)", binSkeleton);
 	}
 
 	// Remember last values to detect parameter changes
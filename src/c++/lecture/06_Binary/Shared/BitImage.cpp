@@ -0,0 +1,414 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include "BitImage.h"
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static inline int popCount(uint64_t word);
+	static inline uint64_t shiftedWord(const uint64_t* row, int numberWords, int wordIndex, int shift, uint64_t fill);
+
+	/*****************************************************************************************************
+	 * Constructors and allocation
+	 *****************************************************************************************************/
+
+	/*! Constructor.
+	*
+	* \param rows [in] Image height
+	* \param cols [in] Image width
+	* \param value [in] Initial value of all pixels
+	*/
+	BitImage::BitImage(int rows, int cols, bool value) {
+		create(rows, cols);
+		setTo(value);
+	}
+
+	/*! Constructor packing a thresholded gray-value image (see fromThreshold()).
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param thresh [in] Threshold to apply
+	* \param isInvert [in] Invert resulting binary image on true
+	*/
+	BitImage::BitImage(const Mat& image, uchar thresh, bool isInvert) {
+		fromThreshold(image, thresh, isInvert);
+	}
+
+	/*! Allocate image. Existing pixel values are kept, if the size does not change.
+	*
+	* \param rows [in] Image height
+	* \param cols [in] Image width
+	*/
+	void BitImage::create(int rows, int cols) {
+		if ((rows <= 0) || (cols <= 0))
+			rows = cols = 0;
+		if ((rows == this->rows) && (cols == this->cols))
+			return;
+
+		this->rows = rows;
+		this->cols = cols;
+		this->wordsPerRow = (this->cols + 63) / 64;
+		this->lastWordMask = (this->cols % 64 == 0) ? ~(uint64_t)0 : ((uint64_t)1 << (this->cols % 64)) - 1;
+		this->words.assign((size_t)this->rows * this->wordsPerRow, 0);
+	}
+
+	/*! Set all pixels to the same value.
+	*
+	* \param value [in] Pixel value
+	*/
+	void BitImage::setTo(bool value) {
+		if (!value) {
+			fill(words.begin(), words.end(), 0);
+			return;
+		}
+
+		for (int y = 0; y < rows; y++) {
+			uint64_t* row = ptr(y);
+			fill(row, row + wordsPerRow, ~(uint64_t)0);
+			row[wordsPerRow - 1] = lastWordMask;
+		}
+	}
+
+	/*! Set single pixel.
+	*
+	* \param x [in] Pixel column
+	* \param y [in] Pixel row
+	* \param value [in] Pixel value
+	*/
+	void BitImage::set(int x, int y, bool value) {
+		uint64_t bit = (uint64_t)1 << (x & 63);
+		uint64_t& word = ptr(y)[x >> 6];
+
+		word = value ? (word | bit) : (word & ~bit);
+	}
+
+	/*****************************************************************************************************
+	 * Conversion from and to 8-bit images
+	 *****************************************************************************************************/
+
+	/*! Apply fixed global threshold and pack result.
+	*
+	* Resulting bits are 0 (for g(x,y) <= thresh) and 1 (for g(x,y) > thresh) as for ip::threshold().
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param thresh [in] Threshold to apply
+	* \param isInvert [in] Invert resulting binary image on true
+	*/
+	void BitImage::fromThreshold(const Mat& image, uchar thresh, bool isInvert) {
+		// Check image type
+		if (image.type() != CV_8U)
+			return;
+
+		create(image.rows, image.cols);
+
+		// Pack 64 pixels per word (rows in parallel)
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				uint64_t* dstRow = ptr(y);
+
+				for (int i = 0; i < wordsPerRow; i++) {
+					const uchar* src = srcRow + 64 * i;
+					int length = min(64, cols - 64 * i);
+					uint64_t bits = 0;
+
+					for (int k = 0; k < length; k++)
+						bits |= (uint64_t)(src[k] > thresh) << k;
+
+					dstRow[i] = isInvert ? ~bits : bits;
+				}
+				dstRow[wordsPerRow - 1] &= lastWordMask;
+			}
+		});
+	}
+
+	/*! Pack binary image (pixels not equal to 0 are set).
+	*
+	* \param binImage [in] Binary image with values in {0, 255} (type CV_8U)
+	*/
+	void BitImage::fromBinary(const Mat& binImage) {
+		fromThreshold(binImage, 0, false);
+	}
+
+	/*! Unpack to 8-bit binary image.
+	*
+	* \param binImage [out] Binary image with values in {0, 255} (type CV_8U)
+	*/
+	void BitImage::toMat(Mat& binImage) const {
+		binImage.create(rows, cols, CV_8U);
+
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uint64_t* srcRow = ptr(y);
+				uchar* dstRow = binImage.ptr<uchar>(y);
+
+				for (int i = 0; i < wordsPerRow; i++) {
+					uchar* dst = dstRow + 64 * i;
+					int length = min(64, cols - 64 * i);
+					uint64_t bits = srcRow[i];
+
+					for (int k = 0; k < length; k++)
+						dst[k] = (uchar)(0 - ((bits >> k) & 1));
+				}
+			}
+		});
+	}
+
+	/*****************************************************************************************************
+	 * Morphology with rectangular structure elements
+	 *****************************************************************************************************/
+
+	/*! Morphological erosion with rectangular structure element (anchor at center).
+	*
+	* Pixels outside the image do not affect the result (same as cv::erode() with default border).
+	*
+	* \param dst [out] Eroded image (may be the source image)
+	* \param size [in] Width and height of structure element
+	*/
+	void BitImage::erode(BitImage& dst, Size size) const {
+		morphRect(dst, size, true);
+	}
+
+	/*! Morphological dilation with rectangular structure element (anchor at center).
+	*
+	* \param dst [out] Dilated image (may be the source image)
+	* \param size [in] Width and height of structure element
+	*/
+	void BitImage::dilate(BitImage& dst, Size size) const {
+		morphRect(dst, size, false);
+	}
+
+	/*! Morphological opening (erosion followed by dilation).
+	*
+	* \param dst [out] Opened image (may be the source image)
+	* \param size [in] Width and height of structure element
+	*/
+	void BitImage::open(BitImage& dst, Size size) const {
+		morphRect(dst, size, true);
+		dst.morphRect(dst, size, false);
+	}
+
+	/*! Morphological closing (dilation followed by erosion).
+	*
+	* \param dst [out] Closed image (may be the source image)
+	* \param size [in] Width and height of structure element
+	*/
+	void BitImage::close(BitImage& dst, Size size) const {
+		morphRect(dst, size, false);
+		dst.morphRect(dst, size, true);
+	}
+
+	/*! Separable erosion or dilation with rectangular structure element.
+	*
+	* The horizontal pass combines shifted copies of each row word by word (64 pixels per operation).
+	* The vertical pass combines the words of neighboring rows. Both passes process rows in parallel.
+	*
+	* \param dst [out] Resulting image (may be the source image)
+	* \param size [in] Width and height of structure element
+	* \param isErode [in] Erode on true, else dilate
+	*/
+	void BitImage::morphRect(BitImage& dst, Size size, bool isErode) const {
+		// Check parameters
+		if (empty() || (size.width < 1) || (size.height < 1))
+			return;
+
+		int anchorX = size.width / 2, anchorY = size.height / 2;
+		uint64_t fill = isErode ? ~(uint64_t)0 : 0;
+		BitImage horizontal(rows, cols);
+
+		// Horizontal pass (unused bits of last word are neutral elements)
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			vector<uint64_t> rowBuffer(wordsPerRow);
+
+			for (int y = range.start; y < range.end; y++) {
+				const uint64_t* srcRow = ptr(y);
+				uint64_t* dstRow = horizontal.ptr(y);
+
+				copy(srcRow, srcRow + wordsPerRow, rowBuffer.begin());
+				rowBuffer[wordsPerRow - 1] |= fill & ~lastWordMask;
+
+				for (int i = 0; i < wordsPerRow; i++) {
+					uint64_t result = fill;
+
+					for (int shift = -anchorX; shift < size.width - anchorX; shift++) {
+						uint64_t word = shiftedWord(rowBuffer.data(), wordsPerRow, i, shift, fill);
+						result = isErode ? (result & word) : (result | word);
+					}
+					dstRow[i] = result;
+				}
+				dstRow[wordsPerRow - 1] &= lastWordMask;
+			}
+		});
+
+		// Vertical pass (rows outside the image are ignored)
+		dst.create(rows, cols);
+
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				int y0 = max(y - anchorY, 0);
+				int y1 = min(y - anchorY + size.height, rows);
+				uint64_t* dstRow = dst.ptr(y);
+
+				for (int i = 0; i < wordsPerRow; i++) {
+					uint64_t result = fill;
+
+					for (int yy = y0; yy < y1; yy++)
+						result = isErode ? (result & horizontal.ptr(yy)[i]) : (result | horizontal.ptr(yy)[i]);
+					dstRow[i] = result;
+				}
+			}
+		});
+	}
+
+	/*****************************************************************************************************
+	 * Logic operations and area
+	 *****************************************************************************************************/
+
+	/*! Pixel-wise AND.
+	*
+	* \param other [in] Second operand of same size
+	* \param dst [out] Result (may be one of the operands)
+	*/
+	void BitImage::bitwiseAnd(const BitImage& other, BitImage& dst) const {
+		if ((other.rows != rows) || (other.cols != cols))
+			return;
+
+		dst.create(rows, cols);
+		for (size_t i = 0; i < words.size(); i++)
+			dst.words[i] = words[i] & other.words[i];
+	}
+
+	/*! Pixel-wise OR.
+	*
+	* \param other [in] Second operand of same size
+	* \param dst [out] Result (may be one of the operands)
+	*/
+	void BitImage::bitwiseOr(const BitImage& other, BitImage& dst) const {
+		if ((other.rows != rows) || (other.cols != cols))
+			return;
+
+		dst.create(rows, cols);
+		for (size_t i = 0; i < words.size(); i++)
+			dst.words[i] = words[i] | other.words[i];
+	}
+
+	/*! Pixel-wise XOR.
+	*
+	* \param other [in] Second operand of same size
+	* \param dst [out] Result (may be one of the operands)
+	*/
+	void BitImage::bitwiseXor(const BitImage& other, BitImage& dst) const {
+		if ((other.rows != rows) || (other.cols != cols))
+			return;
+
+		dst.create(rows, cols);
+		for (size_t i = 0; i < words.size(); i++)
+			dst.words[i] = words[i] ^ other.words[i];
+	}
+
+	/*! Pixel-wise AND NOT (set difference), e.g., binary - eroded to get contours.
+	*
+	* \param other [in] Second operand of same size (pixels to remove)
+	* \param dst [out] Result (may be one of the operands)
+	*/
+	void BitImage::bitwiseAndNot(const BitImage& other, BitImage& dst) const {
+		if ((other.rows != rows) || (other.cols != cols))
+			return;
+
+		dst.create(rows, cols);
+		for (size_t i = 0; i < words.size(); i++)
+			dst.words[i] = words[i] & ~other.words[i];
+	}
+
+	/*! Pixel-wise NOT.
+	*
+	* \param dst [out] Inverted image (may be the source image)
+	*/
+	void BitImage::bitwiseNot(BitImage& dst) const {
+		dst.create(rows, cols);
+
+		for (int y = 0; y < rows; y++) {
+			const uint64_t* srcRow = ptr(y);
+			uint64_t* dstRow = dst.ptr(y);
+
+			for (int i = 0; i < wordsPerRow; i++)
+				dstRow[i] = ~srcRow[i];
+			dstRow[wordsPerRow - 1] &= lastWordMask;
+		}
+	}
+
+	/*! Count set pixels (area of foreground).
+	*
+	* \return Number of pixels with value 1
+	*/
+	uint64_t BitImage::countNonZero(void) const {
+		uint64_t count = 0;
+
+		for (size_t i = 0; i < words.size(); i++)
+			count += popCount(words[i]);
+		return count;
+	}
+
+	/*****************************************************************************************************
+	 * Module internal helpers
+	 *****************************************************************************************************/
+
+	/*! Count bits set in a word.
+	*
+	* \param word [in] Word to count bits in
+	* \return Number of bits set
+	*/
+	static inline int popCount(uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+		return (int)__popcnt64(word);
+#elif defined(__GNUC__)
+		return __builtin_popcountll(word);
+#else
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+
+	/*! Get word of a row shifted by a number of pixels.
+	*
+	* Bit k of the result is pixel (64 * wordIndex + k + shift) of the row.
+	*
+	* \param row [in] Packed row
+	* \param numberWords [in] Number of words in row
+	* \param wordIndex [in] Index of word to get
+	* \param shift [in] Shift in pixels (positive to the right, negative to the left)
+	* \param fill [in] Value of words outside the row
+	* \return Shifted word
+	*/
+	static inline uint64_t shiftedWord(const uint64_t* row, int numberWords, int wordIndex, int shift, uint64_t fill) {
+		int wordShift = (shift >= 0) ? shift / 64 : -((63 - shift) / 64);
+		int bitShift = shift - 64 * wordShift;
+		int index = wordIndex + wordShift;
+		uint64_t low = ((index >= 0) && (index < numberWords)) ? row[index] : fill;
+
+		if (bitShift == 0)
+			return low;
+
+		uint64_t high = ((index + 1 >= 0) && (index + 1 < numberWords)) ? row[index + 1] : fill;
+		return (low >> bitShift) | (high << (64 - bitShift));
+	}
+}
@@ -0,0 +1,76 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_BIT_IMAGE_H
+#define IP_BIT_IMAGE_H
+
+/* Include files */
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/*! Binary image storing 1 bit per pixel packed into 64-bit words.
+	*
+	* Pixel x of a row is stored in bit (x % 64) of word (x / 64). Each row starts with a new word.
+	* Unused bits in the last word of a row are always 0.
+	*/
+	class BitImage {
+	private:
+		int rows = 0;
+		int cols = 0;
+		int wordsPerRow = 0;
+		uint64_t lastWordMask = 0;		// Valid bits in last word of a row
+		std::vector<uint64_t> words;
+
+		void morphRect(BitImage& dst, cv::Size size, bool isErode) const;
+
+	public:
+		// Constructors and allocation
+		BitImage(void) {}
+		BitImage(int rows, int cols, bool value = false);
+		BitImage(const cv::Mat& image, uchar thresh, bool isInvert = false);
+		void create(int rows, int cols);
+		void setTo(bool value);
+
+		// Properties and pixel access
+		int getRows(void) const { return rows; }
+		int getCols(void) const { return cols; }
+		int getWordsPerRow(void) const { return wordsPerRow; }
+		bool empty(void) const { return words.empty(); }
+		uint64_t* ptr(int y) { return words.data() + (size_t)y * wordsPerRow; }
+		const uint64_t* ptr(int y) const { return words.data() + (size_t)y * wordsPerRow; }
+		bool get(int x, int y) const { return (ptr(y)[x >> 6] >> (x & 63)) & 1; }
+		void set(int x, int y, bool value);
+
+		// Conversion from and to 8-bit images
+		void fromThreshold(const cv::Mat& image, uchar thresh, bool isInvert = false);
+		void fromBinary(const cv::Mat& binImage);
+		void toMat(cv::Mat& binImage) const;
+
+		// Morphology with rectangular structure elements
+		void erode(BitImage& dst, cv::Size size = cv::Size(3, 3)) const;
+		void dilate(BitImage& dst, cv::Size size = cv::Size(3, 3)) const;
+		void open(BitImage& dst, cv::Size size = cv::Size(3, 3)) const;
+		void close(BitImage& dst, cv::Size size = cv::Size(3, 3)) const;
+
+		// Logic operations and area
+		void bitwiseAnd(const BitImage& other, BitImage& dst) const;
+		void bitwiseOr(const BitImage& other, BitImage& dst) const;
+		void bitwiseXor(const BitImage& other, BitImage& dst) const;
+		void bitwiseAndNot(const BitImage& other, BitImage& dst) const;
+		void bitwiseNot(BitImage& dst) const;
+		uint64_t countNonZero(void) const;
+	};
+}
+
+#endif /* IP_BIT_IMAGE_H */
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -37,8 +37,12 @@ namespace ip
 
 	/*! Calculate the histogram data for 8-bit grayscale images.
 	*
+	* Bands of rows are counted in parallel. Each band counts into four interleaved partial
+	* histograms, so that consecutive equal gray-values do not stall on the same counter.
+	*
 	* \param image Image to calculate histogram for (8-bit grayscale)
 	* \param histogram Array to store histogram data in
+	* \param cumulative Array to store cumulative histogram data in (optional)
 	*/
 	void calcHistogram(const Mat& image, unsigned histogram[256], unsigned cumulative[256]) {
 		const int NUMBER_BINS = 256;
@@ -47,17 +51,41 @@ namespace ip
 		if (image.type() != CV_8U)
 			return;
 
-		// Init array
+		// Count pixel values (partial histograms for each band of rows)
+		int numberBands = std::max(1, std::min(getNumThreads(), image.rows));
+		vector<unsigned> bandHistograms(4 * NUMBER_BINS * (size_t)numberBands, 0);
+
+		parallel_for_(Range(0, numberBands), [&](const Range& range) {
+			for (int band = range.start; band < range.end; band++) {
+				unsigned* hist0 = &bandHistograms[4 * NUMBER_BINS * (size_t)band];
+				unsigned* hist1 = hist0 + NUMBER_BINS;
+				unsigned* hist2 = hist1 + NUMBER_BINS;
+				unsigned* hist3 = hist2 + NUMBER_BINS;
+				int yStart = band * image.rows / numberBands;
+				int yEnd = (band + 1) * image.rows / numberBands;
+
+				for (int y = yStart; y < yEnd; y++) {
+					const uchar* data = image.ptr<uchar>(y);
+					int x = 0;
+
+					for (; x <= image.cols - 4; x += 4) {
+						hist0[data[x]]++;
+						hist1[data[x + 1]]++;
+						hist2[data[x + 2]]++;
+						hist3[data[x + 3]]++;
+					}
+					for (; x < image.cols; x++)
+						hist0[data[x]]++;
+				}
+			}
+		});
+
+		// Merge partial histograms
 		for (int i = 0; i < NUMBER_BINS; i++)
 			histogram[i] = 0;
 
-		// Count pixel values
-		for (int y = 0; y < image.rows; y++) {
-			const uchar* data = image.ptr<uchar>(y);
-			for (int x = 0; x < image.cols; x++) {
-				histogram[data[x]]++;
-			}
-		}
+		for (size_t i = 0; i < bandHistograms.size(); i++)
+			histogram[i % NUMBER_BINS] += bandHistograms[i];
 
 		// Cumulative histogram
 		if (cumulative != NULL) {
@@ -0,0 +1,118 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <cmath>
+#include <opencv2/opencv.hpp>
+#include "IntegralImage.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/*! Constructor.
+	*
+	* \param image [in] Image to calculate integral images for (type CV_8U)
+	*/
+	IntegralImage::IntegralImage(const Mat& image) {
+		compute(image);
+	}
+
+	/*! Calculate integral images.
+	*
+	* Element (x, y) contains the sum of all pixels with coordinates less than x and y. Rows are first
+	* accumulated independently in parallel. The columns are then accumulated row by row.
+	*
+	* \param image [in] Image to calculate integral images for (type CV_8U)
+	*/
+	void IntegralImage::compute(const Mat& image) {
+		// Check image type
+		if (image.type() != CV_8U)
+			return;
+
+		rows = image.rows;
+		cols = image.cols;
+		size_t stride = (size_t)cols + 1;
+		sums.assign((rows + 1) * stride, 0);
+		squaredSums.assign((rows + 1) * stride, 0);
+
+		// Cumulative sums of rows
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				int64_t* sumRow = &sums[(y + 1) * stride];
+				int64_t* squaredRow = &squaredSums[(y + 1) * stride];
+
+				for (int x = 0; x < cols; x++) {
+					int64_t value = srcRow[x];
+					sumRow[x + 1] = sumRow[x] + value;
+					squaredRow[x + 1] = squaredRow[x] + value * value;
+				}
+			}
+		});
+
+		// Cumulative sums of columns
+		for (int y = 1; y <= rows; y++) {
+			const int64_t* lastSumRow = &sums[(y - 1) * stride];
+			const int64_t* lastSquaredRow = &squaredSums[(y - 1) * stride];
+			int64_t* sumRow = &sums[y * stride];
+			int64_t* squaredRow = &squaredSums[y * stride];
+
+			for (int x = 1; x <= cols; x++) {
+				sumRow[x] += lastSumRow[x];
+				squaredRow[x] += lastSquaredRow[x];
+			}
+		}
+	}
+
+	/*! Get sum and sum of squares of rectangle [x0, x1) x [y0, y1).
+	*
+	* \param x0 [in] Left column (included)
+	* \param y0 [in] Top row (included)
+	* \param x1 [in] Right column (excluded)
+	* \param y1 [in] Bottom row (excluded)
+	* \param sum [out] Sum of gray-values
+	* \param squaredSum [out] Sum of squared gray-values
+	*/
+	void IntegralImage::getSums(int x0, int y0, int x1, int y1, int64_t& sum, int64_t& squaredSum) const {
+		size_t stride = (size_t)cols + 1;
+		size_t topLeft = y0 * stride + x0, topRight = y0 * stride + x1;
+		size_t bottomLeft = y1 * stride + x0, bottomRight = y1 * stride + x1;
+
+		sum = sums[bottomRight] - sums[bottomLeft] - sums[topRight] + sums[topLeft];
+		squaredSum = squaredSums[bottomRight] - squaredSums[bottomLeft] - squaredSums[topRight] + squaredSums[topLeft];
+	}
+
+	/*! Get mean and standard deviation of squared window centered at a pixel.
+	*
+	* The window is cropped at the image borders.
+	*
+	* \param x [in] Column of center pixel
+	* \param y [in] Row of center pixel
+	* \param radius [in] Half window size (window size 2 * radius + 1)
+	* \param mean [out] Mean gray-value
+	* \param stdDev [out] Standard deviation of gray-values
+	*/
+	void IntegralImage::getMeanStdDev(int x, int y, int radius, double& mean, double& stdDev) const {
+		int x0 = std::max(x - radius, 0), x1 = std::min(x + radius + 1, cols);
+		int y0 = std::max(y - radius, 0), y1 = std::min(y + radius + 1, rows);
+		int64_t number = (int64_t)(x1 - x0) * (y1 - y0);
+		int64_t sum, squaredSum;
+
+		getSums(x0, y0, x1, y1, sum, squaredSum);
+
+		// Variance n^2 * sigma^2 = n * sum(g^2) - sum(g)^2 is exact in integer arithmetics
+		mean = (double)sum / number;
+		stdDev = sqrt((double)(number * squaredSum - sum * sum)) / number;
+	}
+}
@@ -0,0 +1,48 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_INTEGRAL_IMAGE_H
+#define IP_INTEGRAL_IMAGE_H
+
+/* Include files */
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/*! Integral images of gray-values and squared gray-values (64-bit sums).
+	*
+	* Sum and sum of squares of any rectangle are calculated from four values each, i.e., local means
+	* and variances cost O(1) per pixel independent of the window size. The sums are exact for images
+	* with up to 10^7 pixels per window.
+	*/
+	class IntegralImage {
+	private:
+		int rows = 0;
+		int cols = 0;
+		std::vector<int64_t> sums;			// (rows + 1) x (cols + 1) values
+		std::vector<int64_t> squaredSums;	// (rows + 1) x (cols + 1) values
+
+	public:
+		IntegralImage(void) {}
+		IntegralImage(const cv::Mat& image);
+		void compute(const cv::Mat& image);
+
+		int getRows(void) const { return rows; }
+		int getCols(void) const { return cols; }
+		bool empty(void) const { return sums.empty(); }
+		void getSums(int x0, int y0, int x1, int y1, int64_t& sum, int64_t& squaredSum) const;
+		void getMeanStdDev(int x, int y, int radius, double& mean, double& stdDev) const;
+	};
+}
+
+#endif /* IP_INTEGRAL_IMAGE_H */
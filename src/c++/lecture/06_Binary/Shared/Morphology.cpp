@@ -0,0 +1,280 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "Morphology.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static void lowerEnvelope(const int64_t* f, int length, int64_t* d, vector<int>& sites, vector<double>& borders);
+
+	/*****************************************************************************************************
+	 * Distance transform
+	 *****************************************************************************************************/
+
+	/*! Exact squared Euclidean distance transform (Felzenszwalb/Huttenlocher).
+	*
+	* Reference: P. F. Felzenszwalb, D. P. Huttenlocher: Distance transforms of sampled functions,
+	* Theory of Computing 8(19), 2012, pp. 415-428.
+	*
+	* The 2D transform is separated into 1D transforms of columns and rows, each in linear time:
+	* 1. Columns: Distance to nearest site in the same column by a forward and a backward scan.
+	*    The scans run over complete rows, bands of columns are processed in parallel.
+	* 2. Rows: Lower envelope of the parabolas (x - q)^2 + f(q) given by the column distances f.
+	*    Rows are processed in parallel.
+	*
+	* Sites are the background pixels (value 0). Pixels outside of the image are no sites. If the image
+	* does not contain any site, all distances are INT_MAX.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param squaredDistances [out] Squared distance of each pixel to the nearest site (type CV_32S)
+	* \param isToForeground [in] Sites are foreground pixels (value not 0) instead of background pixels on true
+	*/
+	void squaredDistanceTransform(const Mat& binImage, Mat& squaredDistances, bool isToForeground) {
+		// Check image type
+		if (binImage.type() != CV_8U)
+			return;
+
+		const int64_t INF = INT64_MAX / 4;
+		int rows = binImage.rows, cols = binImage.cols;
+		vector<int64_t> columnDistances((size_t)rows * cols);
+
+		// 1. Columns: Forward and backward scan (bands of columns in parallel)
+		parallel_for_(Range(0, cols), [&](const Range& range) {
+			for (int y = 0; y < rows; y++) {
+				const uchar* srcRow = binImage.ptr<uchar>(y);
+				int64_t* distRow = &columnDistances[(size_t)y * cols];
+				const int64_t* lastRow = (y > 0) ? distRow - cols : NULL;
+
+				for (int x = range.start; x < range.end; x++) {
+					bool isSite = ((srcRow[x] != 0) == isToForeground);
+					distRow[x] = isSite ? 0 : ((lastRow != NULL) && (lastRow[x] < INF) ? lastRow[x] + 1 : INF);
+				}
+			}
+
+			for (int y = rows - 2; y >= 0; y--) {
+				int64_t* distRow = &columnDistances[(size_t)y * cols];
+				const int64_t* nextRow = distRow + cols;
+
+				for (int x = range.start; x < range.end; x++) {
+					if (nextRow[x] + 1 < distRow[x])
+						distRow[x] = nextRow[x] + 1;
+				}
+			}
+		});
+
+		// 2. Rows: Lower envelope of parabolas (rows in parallel)
+		squaredDistances.create(rows, cols, CV_32S);
+
+		parallel_for_(Range(0, rows), [&](const Range& range) {
+			vector<int64_t> f(cols), d(cols);
+			vector<int> sites(cols);
+			vector<double> borders(cols + 1);
+
+			for (int y = range.start; y < range.end; y++) {
+				const int64_t* distRow = &columnDistances[(size_t)y * cols];
+				int* dstRow = squaredDistances.ptr<int>(y);
+
+				for (int x = 0; x < cols; x++)
+					f[x] = (distRow[x] < INF) ? distRow[x] * distRow[x] : INF;
+
+				lowerEnvelope(f.data(), cols, d.data(), sites, borders);
+
+				for (int x = 0; x < cols; x++)
+					dstRow[x] = (d[x] < INF) ? (int)std::min(d[x], (int64_t)INT_MAX) : INT_MAX;
+			}
+		});
+	}
+
+	/*! Exact Euclidean distance transform.
+	*
+	* See squaredDistanceTransform() for details. If the image does not contain any site,
+	* all distances are FLT_MAX.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param distances [out] Distance of each pixel to the nearest site (type CV_32F)
+	* \param isToForeground [in] Sites are foreground pixels (value not 0) instead of background pixels on true
+	*/
+	void distanceTransform(const Mat& binImage, Mat& distances, bool isToForeground) {
+		Mat squaredDistances;
+
+		squaredDistanceTransform(binImage, squaredDistances, isToForeground);
+		if (squaredDistances.empty())
+			return;
+
+		distances.create(binImage.rows, binImage.cols, CV_32F);
+		parallel_for_(Range(0, binImage.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const int* srcRow = squaredDistances.ptr<int>(y);
+				float* dstRow = distances.ptr<float>(y);
+
+				for (int x = 0; x < binImage.cols; x++)
+					dstRow[x] = (srcRow[x] < INT_MAX) ? sqrt((float)srcRow[x]) : FLT_MAX;
+			}
+		});
+	}
+
+	/*! Lower envelope of parabolas (x - q)^2 + f(q) for a 1D function f.
+	*
+	* Sites with infinite values are skipped. If there is no finite site, d is infinite everywhere.
+	*
+	* \param f [in] Function values at the sites (infinite if no site)
+	* \param length [in] Number of values
+	* \param d [out] Lower envelope evaluated at each position
+	* \param sites [in] Working memory for parabola sites (at least length elements)
+	* \param borders [in] Working memory for borders between parabolas (at least length + 1 elements)
+	*/
+	static void lowerEnvelope(const int64_t* f, int length, int64_t* d, vector<int>& sites, vector<double>& borders) {
+		const int64_t INF = INT64_MAX / 4;
+		int k = -1;
+
+		// Compute lower envelope
+		for (int q = 0; q < length; q++) {
+			if (f[q] >= INF)
+				continue;
+
+			double s = -DBL_MAX;
+			while (k >= 0) {
+				int v = sites[k];
+				s = ((double)(f[q] + (int64_t)q * q) - (double)(f[v] + (int64_t)v * v)) / (2.0 * (q - v));
+				if (s > borders[k])
+					break;
+				k--;
+			}
+
+			k++;
+			sites[k] = q;
+			borders[k] = (k == 0) ? -DBL_MAX : s;
+			borders[k + 1] = DBL_MAX;
+		}
+
+		// No finite site
+		if (k < 0) {
+			fill(d, d + length, INF);
+			return;
+		}
+
+		// Evaluate lower envelope
+		for (int q = 0, j = 0; q < length; q++) {
+			while (borders[j + 1] < q)
+				j++;
+
+			int64_t dx = q - sites[j];
+			d[q] = dx * dx + f[sites[j]];
+		}
+	}
+
+	/*****************************************************************************************************
+	 * Morphology with disk-shaped structure elements
+	 *****************************************************************************************************/
+
+	/*! Threshold squared distances by a radius.
+	*
+	* Resulting values are 255 for distances larger than the radius (d^2 > r^2) and 0 else. Applied to
+	* the distances to the background, this is an erosion with a disk of the given radius. Applied
+	* inverted to the distances to the foreground, this is a dilation. Once the distance map exists,
+	* each further radius costs only one threshold.
+	*
+	* \param squaredDistances [in] Squared distances (type CV_32S)
+	* \param binImage [out] Resulting binary image with values in {0, 255}
+	* \param radius [in] Radius of disk
+	* \param isInvert [in] Invert resulting binary image on true (255 for d^2 <= r^2)
+	*/
+	void thresholdDistances(const Mat& squaredDistances, Mat& binImage, double radius, bool isInvert) {
+		// Check image type
+		if (squaredDistances.type() != CV_32S)
+			return;
+
+		// Largest squared distance inside disk (distances are integers)
+		int64_t maxInside = (int64_t)floor(radius * radius);
+		int thresh = (int)std::min(maxInside, (int64_t)INT_MAX - 1);
+		uchar inside = isInvert ? 255 : 0;
+		uchar outside = 255 - inside;
+
+		binImage.create(squaredDistances.rows, squaredDistances.cols, CV_8U);
+		parallel_for_(Range(0, squaredDistances.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const int* srcRow = squaredDistances.ptr<int>(y);
+				uchar* dstRow = binImage.ptr<uchar>(y);
+
+				for (int x = 0; x < squaredDistances.cols; x++)
+					dstRow[x] = (srcRow[x] > thresh) ? outside : inside;
+			}
+		});
+	}
+
+	/*! Morphological erosion with a disk (pixels with distance <= radius to the center).
+	*
+	* A pixel remains set, if its distance to the nearest background pixel is larger than the radius.
+	* Pixels outside of the image do not affect the result (same as cv::erode() with default border).
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param eroded [out] Eroded image with values in {0, 255}
+	* \param radius [in] Radius of disk
+	*/
+	void erodeDisk(const Mat& binImage, Mat& eroded, double radius) {
+		Mat squaredDistances;
+
+		squaredDistanceTransform(binImage, squaredDistances, false);
+		thresholdDistances(squaredDistances, eroded, radius, false);
+	}
+
+	/*! Morphological dilation with a disk (pixels with distance <= radius to the center).
+	*
+	* A pixel is set, if its distance to the nearest foreground pixel is not larger than the radius.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param dilated [out] Dilated image with values in {0, 255}
+	* \param radius [in] Radius of disk
+	*/
+	void dilateDisk(const Mat& binImage, Mat& dilated, double radius) {
+		Mat squaredDistances;
+
+		squaredDistanceTransform(binImage, squaredDistances, true);
+		thresholdDistances(squaredDistances, dilated, radius, true);
+	}
+
+	/*! Morphological opening (erosion followed by dilation) with a disk.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param opened [out] Opened image with values in {0, 255}
+	* \param radius [in] Radius of disk
+	*/
+	void openDisk(const Mat& binImage, Mat& opened, double radius) {
+		Mat eroded;
+
+		erodeDisk(binImage, eroded, radius);
+		dilateDisk(eroded, opened, radius);
+	}
+
+	/*! Morphological closing (dilation followed by erosion) with a disk.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param closed [out] Closed image with values in {0, 255}
+	* \param radius [in] Radius of disk
+	*/
+	void closeDisk(const Mat& binImage, Mat& closed, double radius) {
+		Mat dilated;
+
+		dilateDisk(binImage, dilated, radius);
+		erodeDisk(dilated, closed, radius);
+	}
+}
@@ -0,0 +1,30 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_MORPHOLOGY_H
+#define IP_MORPHOLOGY_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Prototypes */
+	void squaredDistanceTransform(const cv::Mat& binImage, cv::Mat& squaredDistances, bool isToForeground = false);
+	void distanceTransform(const cv::Mat& binImage, cv::Mat& distances, bool isToForeground = false);
+	void thresholdDistances(const cv::Mat& squaredDistances, cv::Mat& binImage, double radius, bool isInvert = false);
+	void erodeDisk(const cv::Mat& binImage, cv::Mat& eroded, double radius);
+	void dilateDisk(const cv::Mat& binImage, cv::Mat& dilated, double radius);
+	void openDisk(const cv::Mat& binImage, cv::Mat& opened, double radius);
+	void closeDisk(const cv::Mat& binImage, cv::Mat& closed, double radius);
+}
+
+#endif /* IP_MORPHOLOGY_H */
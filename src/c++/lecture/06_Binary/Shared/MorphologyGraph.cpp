@@ -0,0 +1,239 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include "MorphologyGraph.h"
+#include "Morphology.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/*****************************************************************************************************
+	 * Constructor and graph nodes
+	 *****************************************************************************************************/
+
+	/*! Constructor (graph containing the input node only).
+	*/
+	MorphologyGraph::MorphologyGraph(void) {
+		clear();
+	}
+
+	/*! Remove all nodes except the input node.
+	*/
+	void MorphologyGraph::clear(void) {
+		BitImage input;
+
+		if (!nodes.empty())
+			input = nodes[INPUT].result;
+
+		nodes.clear();
+		nodeIds.clear();
+
+		nodes.resize(1);
+		nodes[INPUT].result = input;
+		nodes[INPUT].version = inputVersion;
+	}
+
+	/*! Get node of an operation. Existing nodes with the same operation, structure, and input are reused.
+	*
+	* \param operation [in] Erosion or dilation
+	* \param structure [in] Structure element
+	* \param input [in] Node ID of operand
+	* \return Node ID
+	*/
+	int MorphologyGraph::addNode(MorphOperation operation, structureElement structure, int input) {
+		// Check parameters
+		if ((input < 0) || (input >= (int)nodes.size()) || (structure.size < 1))
+			return -1;
+
+		// Common subexpression?
+		auto key = make_tuple((int)operation, (int)structure.shape, structure.size, input);
+		auto existing = nodeIds.find(key);
+		if (existing != nodeIds.end())
+			return existing->second;
+
+		// Add new node
+		graphNode node;
+		node.operation = operation;
+		node.structure = structure;
+		node.input = input;
+		node.depth = nodes[input].depth + 1;
+		node.version = inputVersion - 1;		// Not evaluated, yet
+
+		nodes.push_back(node);
+		nodeIds[key] = (int)nodes.size() - 1;
+		return (int)nodes.size() - 1;
+	}
+
+	/*****************************************************************************************************
+	 * Input image
+	 *****************************************************************************************************/
+
+	/*! Set input image. Invalidates all cached results.
+	*
+	* \param binImage [in] Binary image with values in {0, 255} (type CV_8U)
+	*/
+	void MorphologyGraph::setInput(const Mat& binImage) {
+		BitImage bits;
+
+		bits.fromBinary(binImage);
+		setInput(bits);
+	}
+
+	/*! Set input image. Invalidates all cached results.
+	*
+	* \param binImage [in] Bit-packed binary image
+	*/
+	void MorphologyGraph::setInput(const BitImage& binImage) {
+		inputVersion++;
+		nodes[INPUT].result = binImage;
+		nodes[INPUT].version = inputVersion;
+	}
+
+	/*****************************************************************************************************
+	 * Build graph
+	 *****************************************************************************************************/
+
+	/*! Add erosion.
+	*
+	* \param input [in] Node ID of operand
+	* \param structure [in] Structure element
+	* \return Node ID (-1 for invalid parameters)
+	*/
+	int MorphologyGraph::erode(int input, structureElement structure) {
+		return addNode(MorphOperation::ERODE, structure, input);
+	}
+
+	/*! Add dilation.
+	*
+	* \param input [in] Node ID of operand
+	* \param structure [in] Structure element
+	* \return Node ID (-1 for invalid parameters)
+	*/
+	int MorphologyGraph::dilate(int input, structureElement structure) {
+		return addNode(MorphOperation::DILATE, structure, input);
+	}
+
+	/*! Add opening (erosion followed by dilation).
+	*
+	* \param input [in] Node ID of operand
+	* \param structure [in] Structure element
+	* \return Node ID (-1 for invalid parameters)
+	*/
+	int MorphologyGraph::open(int input, structureElement structure) {
+		int eroded = erode(input, structure);
+		return (eroded >= 0) ? dilate(eroded, structure) : -1;
+	}
+
+	/*! Add closing (dilation followed by erosion).
+	*
+	* \param input [in] Node ID of operand
+	* \param structure [in] Structure element
+	* \return Node ID (-1 for invalid parameters)
+	*/
+	int MorphologyGraph::close(int input, structureElement structure) {
+		int dilated = dilate(input, structure);
+		return (dilated >= 0) ? erode(dilated, structure) : -1;
+	}
+
+	/*****************************************************************************************************
+	 * Evaluate graph
+	 *****************************************************************************************************/
+
+	/*! Evaluate nodes whose cached results are not valid for the current input.
+	*
+	* Nodes to evaluate are grouped by their depth. All nodes of one depth only depend on nodes of
+	* smaller depths, so that they are evaluated in parallel.
+	*
+	* \param ids [in] Node IDs of requested results
+	*/
+	void MorphologyGraph::evaluate(const vector<int>& ids) {
+		// Collect invalid nodes the requested nodes depend on
+		vector<vector<int>> levels;
+		vector<bool> isCollected(nodes.size(), false);
+
+		for (int id : ids) {
+			while ((id > INPUT) && (id < (int)nodes.size()) && !isCollected[id] && (nodes[id].version != inputVersion)) {
+				isCollected[id] = true;
+				if ((int)levels.size() <= nodes[id].depth)
+					levels.resize(nodes[id].depth + 1);
+				levels[nodes[id].depth].push_back(id);
+				id = nodes[id].input;
+			}
+		}
+
+		// Evaluate levels in ascending order (nodes of a level in parallel)
+		for (const vector<int>& level : levels) {
+			parallel_for_(Range(0, (int)level.size()), [&](const Range& range) {
+				for (int i = range.start; i < range.end; i++)
+					evaluateNode(level[i]);
+			});
+			numberEvaluations += level.size();
+		}
+	}
+
+	/*! Evaluate single node (operand must be valid).
+	*
+	* Rectangles are processed on the bit-packed images. Disks are processed by thresholding distance maps.
+	*
+	* \param id [in] Node ID
+	*/
+	void MorphologyGraph::evaluateNode(int id) {
+		graphNode& node = nodes[id];
+		const BitImage& input = nodes[node.input].result;
+		bool isErode = (node.operation == MorphOperation::ERODE);
+
+		if (node.structure.shape == StructureShape::RECT) {
+			Size size(node.structure.size, node.structure.size);
+
+			if (isErode)
+				input.erode(node.result, size);
+			else
+				input.dilate(node.result, size);
+		}
+		else {
+			Mat binImage, squaredDistances;
+			double radius = 0.5 * (node.structure.size - 1);
+
+			input.toMat(binImage);
+			squaredDistanceTransform(binImage, squaredDistances, !isErode);
+			thresholdDistances(squaredDistances, binImage, radius, !isErode);
+			node.result.fromBinary(binImage);
+		}
+		node.version = inputVersion;
+	}
+
+	/*! Get bit-packed result of a node (evaluated, if needed).
+	*
+	* \param id [in] Node ID
+	* \return Result of node
+	*/
+	const BitImage& MorphologyGraph::getBits(int id) {
+		if ((id < 0) || (id >= (int)nodes.size()))
+			id = INPUT;
+
+		evaluate(vector<int>(1, id));
+		return nodes[id].result;
+	}
+
+	/*! Get result of a node (evaluated, if needed).
+	*
+	* \param id [in] Node ID
+	* \param binImage [out] Binary image with values in {0, 255} (type CV_8U)
+	*/
+	void MorphologyGraph::getResult(int id, Mat& binImage) {
+		getBits(id).toMat(binImage);
+	}
+}
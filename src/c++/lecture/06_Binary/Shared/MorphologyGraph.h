@@ -0,0 +1,89 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_MORPHOLOGY_GRAPH_H
+#define IP_MORPHOLOGY_GRAPH_H
+
+/* Include files */
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "BitImage.h"
+
+namespace ip
+{
+	/* Enumerations */
+	enum class MorphOperation { ERODE, DILATE };
+	enum class StructureShape { RECT, DISK };
+
+	/* Data structures */
+	typedef struct structureElement {
+		StructureShape shape = StructureShape::RECT;
+		int size = 3;			// Width and height (rectangle) or diameter (disk) in pixels
+	} structureElement;
+
+	/*! Expression graph of morphological operations with cached results.
+	*
+	* Each node is an erosion or dilation of another node. Opening and closing are composed of these,
+	* so that equal subexpressions (e.g., the dilation inside a closing) are represented by the same
+	* node. Node results are cached and remain valid until the input image changes. Nodes that do not
+	* depend on each other are evaluated in parallel.
+	*/
+	class MorphologyGraph {
+	public:
+		static const int INPUT = 0;		// Node ID of input image
+
+	private:
+		typedef struct graphNode {
+			MorphOperation operation = MorphOperation::ERODE;
+			structureElement structure;
+			int input = -1;				// Node ID of operand (INPUT for input image, -1 for input node without operand)
+			int depth = 0;				// Number of operations from input image
+			uint64_t version = 0;		// Input version the result was calculated for
+			BitImage result;
+		} graphNode;
+
+		std::vector<graphNode> nodes;
+		std::map<std::tuple<int, int, int, int>, int> nodeIds;		// (operation, shape, size, input) => node ID
+		uint64_t inputVersion = 0;
+		uint64_t numberEvaluations = 0;
+
+		int addNode(MorphOperation operation, structureElement structure, int input);
+		void evaluateNode(int id);
+
+	public:
+		MorphologyGraph(void);
+		void clear(void);
+
+		// Input image
+		void setInput(const cv::Mat& binImage);
+		void setInput(const BitImage& binImage);
+
+		// Build graph (returns node IDs)
+		int erode(int input, structureElement structure);
+		int dilate(int input, structureElement structure);
+		int open(int input, structureElement structure);
+		int close(int input, structureElement structure);
+
+		// Evaluate graph and get results
+		void evaluate(const std::vector<int>& ids);
+		const BitImage& getBits(int id);
+		void getResult(int id, cv::Mat& binImage);
+
+		// Statistics
+		int getNumberNodes(void) const { return (int)nodes.size(); }
+		uint64_t getNumberEvaluations(void) const { return numberEvaluations; }
+	};
+}
+
+#endif /* IP_MORPHOLOGY_GRAPH_H */
@@ -0,0 +1,231 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "Skeleton.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static void createThinningTable(ThinningMethod method, uchar table[2][256]);
+
+	/* Pixel states during thinning */
+	static const uchar STABLE_FIRST = 1;		// Not deletable in first sub-iteration (unchanged neighborhood since)
+	static const uchar STABLE_SECOND = 2;		// Not deletable in second sub-iteration (unchanged neighborhood since)
+	static const uchar IS_CANDIDATE = 4;		// Pixel is in list of candidates
+
+	/*! Thinning of binary regions to skeletons of one pixel width (8-connected).
+	*
+	* Each iteration consists of two sub-iterations deleting pixels from opposite sides of the regions.
+	* Whether a pixel is deleted depends on its 8 neighbors only, so that the decision for each of the
+	* 256 neighborhoods is looked up in a precomputed table:
+	* - Zhang/Suen: T. Y. Zhang, C. Y. Suen: A fast parallel algorithm for thinning digital patterns,
+	*   Communications of the ACM 27(3), 1984, pp. 236-239.
+	* - Guo/Hall: Z. Guo, R. W. Hall: Parallel thinning with two-subiteration algorithms,
+	*   Communications of the ACM 32(3), 1989, pp. 359-373.
+	*
+	* Only candidate pixels are evaluated. Initially, these are the region pixels next to the
+	* background. A candidate is dropped, when it was not deletable in both sub-iterations, and
+	* becomes a candidate again, when a neighbor is deleted. Later iterations therefore only touch the
+	* shrinking frontier of the regions. Candidates are stored in raster order and evaluated in
+	* parallel bands. The result is identical to scanning all pixels in each sub-iteration.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param skeleton [out] Skeleton with values in {0, 255}
+	* \param method [in] Thinning algorithm
+	*/
+	void skeletonize(const Mat& binImage, Mat& skeleton, ThinningMethod method) {
+		// Check image type
+		if (binImage.type() != CV_8U)
+			return;
+
+		// Lookup tables of deletable neighborhoods (bits 0 to 7: N, NE, E, SE, S, SW, W, NW)
+		uchar table[2][256];
+		createThinningTable(method, table);
+
+		// Copy image with values in {0, 1} and a border of zeros
+		int rows = binImage.rows, cols = binImage.cols;
+		int stride = cols + 2;
+		vector<uchar> pixels((size_t)(rows + 2) * stride, 0);
+
+		for (int y = 0; y < rows; y++) {
+			const uchar* srcRow = binImage.ptr<uchar>(y);
+			uchar* dstRow = &pixels[(size_t)(y + 1) * stride + 1];
+
+			for (int x = 0; x < cols; x++)
+				dstRow[x] = (srcRow[x] != 0) ? 1 : 0;
+		}
+
+		// Offsets of neighbors (same order as table bits)
+		const int offsets[8] = { -stride, -stride + 1, 1, stride + 1, stride, stride - 1, -1, -stride - 1 };
+
+		// Initial candidates: Region pixels with a background neighbor
+		vector<uchar> states(pixels.size(), 0);
+		vector<int> candidates;
+
+		for (int y = 1; y <= rows; y++) {
+			for (int i = y * stride + 1; i <= y * stride + cols; i++) {
+				if (pixels[i] == 0)
+					continue;
+
+				for (int k = 0; k < 8; k++) {
+					if (pixels[i + offsets[k]] == 0) {
+						candidates.push_back(i);
+						states[i] = IS_CANDIDATE;
+						break;
+					}
+				}
+			}
+		}
+
+		// Alternate sub-iterations until two subsequent sub-iterations do not delete any pixel
+		vector<uchar> isDelete;
+		vector<int> nextCandidates;
+		int numberUnchanged = 0;
+
+		for (int subIteration = 0; (numberUnchanged < 2) && !candidates.empty(); subIteration = 1 - subIteration) {
+			const uchar* subTable = table[subIteration];
+			uchar stableFlag = (subIteration == 0) ? STABLE_FIRST : STABLE_SECOND;
+
+			// Evaluate candidates in parallel (all decisions based on the same state)
+			isDelete.assign(candidates.size(), 0);
+			parallel_for_(Range(0, (int)candidates.size()), [&](const Range& range) {
+				for (int c = range.start; c < range.end; c++) {
+					int i = candidates[c];
+					int code = 0;
+
+					for (int k = 0; k < 8; k++)
+						code |= pixels[i + offsets[k]] << k;
+					isDelete[c] = subTable[code];
+				}
+			});
+
+			// Delete pixels and mark remaining candidates stable for this sub-iteration
+			bool isChanged = false;
+
+			for (size_t c = 0; c < candidates.size(); c++) {
+				int i = candidates[c];
+
+				if (isDelete[c]) {
+					pixels[i] = 0;
+					states[i] = 0;
+					isChanged = true;
+				}
+				else
+					states[i] |= stableFlag;
+			}
+			numberUnchanged = isChanged ? 0 : numberUnchanged + 1;
+
+			// Neighbors of deleted pixels are not stable anymore
+			nextCandidates.clear();
+
+			for (size_t c = 0; c < candidates.size(); c++) {
+				if (!isDelete[c])
+					continue;
+
+				int i = candidates[c];
+				for (int k = 0; k < 8; k++) {
+					int neighbor = i + offsets[k];
+
+					if (pixels[neighbor] != 0) {
+						if (!(states[neighbor] & IS_CANDIDATE))
+							nextCandidates.push_back(neighbor);
+						states[neighbor] = IS_CANDIDATE;
+					}
+				}
+			}
+
+			// Keep candidates not stable for both sub-iterations
+			for (int i : candidates) {
+				if (states[i] == (IS_CANDIDATE | STABLE_FIRST | STABLE_SECOND))
+					states[i] = 0;
+				else if (states[i] & IS_CANDIDATE)
+					nextCandidates.push_back(i);
+			}
+
+			// Raster order for banded evaluation
+			sort(nextCandidates.begin(), nextCandidates.end());
+			candidates.swap(nextCandidates);
+		}
+
+		// Copy result
+		skeleton.create(rows, cols, CV_8U);
+		for (int y = 0; y < rows; y++) {
+			const uchar* srcRow = &pixels[(size_t)(y + 1) * stride + 1];
+			uchar* dstRow = skeleton.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++)
+				dstRow[x] = srcRow[x] ? 255 : 0;
+		}
+	}
+
+	/*! Thinning of bit-packed binary regions to skeletons of one pixel width (8-connected).
+	*
+	* See skeletonize() for byte images for details.
+	*
+	* \param binImage [in] Bit-packed binary image
+	* \param skeleton [out] Bit-packed skeleton
+	* \param method [in] Thinning algorithm
+	*/
+	void skeletonize(const BitImage& binImage, BitImage& skeleton, ThinningMethod method) {
+		Mat bytes;
+
+		binImage.toMat(bytes);
+		skeletonize(bytes, bytes, method);
+		skeleton.fromBinary(bytes);
+	}
+
+	/*! Create lookup tables of pixels to delete for both sub-iterations.
+	*
+	* The neighbors p2 to p9 are N, NE, E, SE, S, SW, W, NW and correspond to bits 0 to 7 of the
+	* table index.
+	*
+	* \param method [in] Thinning algorithm
+	* \param table [out] Pixel is deleted (1) or not (0) in sub-iteration 0 or 1 for each neighborhood
+	*/
+	static void createThinningTable(ThinningMethod method, uchar table[2][256]) {
+		for (int code = 0; code < 256; code++) {
+			int p[10];
+			for (int k = 0; k < 8; k++)
+				p[k + 2] = (code >> k) & 1;
+
+			if (method == ThinningMethod::ZHANG_SUEN) {
+				// Number of region neighbors and of 0-1 transitions in sequence p2, ..., p9, p2
+				int numberNeighbors = 0, numberTransitions = 0;
+				for (int k = 2; k <= 9; k++) {
+					numberNeighbors += p[k];
+					numberTransitions += (p[k] == 0) && (p[(k < 9) ? k + 1 : 2] == 1);
+				}
+
+				bool isCandidate = (numberNeighbors >= 2) && (numberNeighbors <= 6) && (numberTransitions == 1);
+				table[0][code] = isCandidate && (p[2] * p[4] * p[6] == 0) && (p[4] * p[6] * p[8] == 0);
+				table[1][code] = isCandidate && (p[2] * p[4] * p[8] == 0) && (p[2] * p[6] * p[8] == 0);
+			}
+			else {
+				// Number of 8-connected components in neighborhood and neighborhood sizes
+				int c = (!p[2] & (p[3] | p[4])) + (!p[4] & (p[5] | p[6])) + (!p[6] & (p[7] | p[8])) + (!p[8] & (p[9] | p[2]));
+				int n1 = (p[9] | p[2]) + (p[3] | p[4]) + (p[5] | p[6]) + (p[7] | p[8]);
+				int n2 = (p[2] | p[3]) + (p[4] | p[5]) + (p[6] | p[7]) + (p[8] | p[9]);
+				int n = std::min(n1, n2);
+
+				bool isCandidate = (c == 1) && (n >= 2) && (n <= 3);
+				table[0][code] = isCandidate && (((p[6] | p[7] | !p[9]) & p[8]) == 0);
+				table[1][code] = isCandidate && (((p[2] | p[3] | !p[5]) & p[4]) == 0);
+			}
+		}
+	}
+}
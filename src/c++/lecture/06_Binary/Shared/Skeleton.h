@@ -0,0 +1,29 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_SKELETON_H
+#define IP_SKELETON_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+#include "BitImage.h"
+
+namespace ip
+{
+	/* Enumerations */
+	enum class ThinningMethod { ZHANG_SUEN, GUO_HALL };
+
+	/* Prototypes */
+	void skeletonize(const cv::Mat& binImage, cv::Mat& skeleton, ThinningMethod method = ThinningMethod::ZHANG_SUEN);
+	void skeletonize(const BitImage& binImage, BitImage& skeleton, ThinningMethod method = ThinningMethod::ZHANG_SUEN);
+}
+
+#endif /* IP_SKELETON_H */
@@ -0,0 +1,316 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <cfloat>
+#include <cmath>
+#include <opencv2/opencv.hpp>
+#include "ThresholdSelector.h"
+#include "Histogram.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/*****************************************************************************************************
+	 * Histogram and prefix tables
+	 *****************************************************************************************************/
+
+	/*! Constructor (empty histogram).
+	*/
+	ThresholdSelector::ThresholdSelector(void) {
+		for (int g = 0; g < 256; g++)
+			histogram[g] = 0;
+		calcPrefixTables();
+	}
+
+	/*! Constructor.
+	*
+	* \param image [in] Image to select thresholds for (type CV_8U)
+	*/
+	ThresholdSelector::ThresholdSelector(const Mat& image) : ThresholdSelector() {
+		setImage(image);
+	}
+
+	/*! Calculate histogram and prefix tables of an image.
+	*
+	* \param image [in] Image to select thresholds for (type CV_8U)
+	*/
+	void ThresholdSelector::setImage(const Mat& image) {
+		// Check image type
+		if (image.type() != CV_8U)
+			return;
+
+		calcHistogram(image, histogram);
+		calcPrefixTables();
+	}
+
+	/*! Set histogram and calculate prefix tables.
+	*
+	* \param histogram [in] Histogram of 8-bit gray-values
+	*/
+	void ThresholdSelector::setHistogram(const unsigned histogram[256]) {
+		for (int g = 0; g < 256; g++)
+			this->histogram[g] = histogram[g];
+		calcPrefixTables();
+	}
+
+	/*! Calculate prefix tables of pixel counts (zeroth moment), gray-value sums (first moment),
+	* and entropy terms h(g) * ln(h(g)).
+	*/
+	void ThresholdSelector::calcPrefixTables(void) {
+		uint64_t count = 0, sum = 0;
+		double entropy = 0.0;
+
+		for (int g = 0; g < 256; g++) {
+			count += histogram[g];
+			sum += (uint64_t)g * histogram[g];
+			if (histogram[g] > 0)
+				entropy += histogram[g] * log((double)histogram[g]);
+
+			counts[g] = count;
+			sums[g] = sum;
+			entropies[g] = entropy;
+		}
+		numberPixels = count;
+	}
+
+	/*! Get number of pixels with gray-values in [first, last].
+	*/
+	uint64_t ThresholdSelector::getCount(int first, int last) const {
+		return counts[last] - ((first > 0) ? counts[first - 1] : 0);
+	}
+
+	/*! Get sum of gray-values in [first, last].
+	*/
+	uint64_t ThresholdSelector::getSum(int first, int last) const {
+		return sums[last] - ((first > 0) ? sums[first - 1] : 0);
+	}
+
+	/*! Get minimum gray-value in image.
+	*
+	* \return Smallest gray-value with non-zero histogram count (0 for empty histogram)
+	*/
+	uchar ThresholdSelector::getMinGray(void) const {
+		for (int g = 0; g < 256; g++) {
+			if (histogram[g] > 0)
+				return (uchar)g;
+		}
+		return 0;
+	}
+
+	/*! Get maximum gray-value in image.
+	*
+	* \return Largest gray-value with non-zero histogram count (0 for empty histogram)
+	*/
+	uchar ThresholdSelector::getMaxGray(void) const {
+		for (int g = 255; g >= 0; g--) {
+			if (histogram[g] > 0)
+				return (uchar)g;
+		}
+		return 0;
+	}
+
+	/*! Get mean gray-value in image.
+	*
+	* \return Mean gray-value (0 for empty histogram)
+	*/
+	double ThresholdSelector::getMean(void) const {
+		return (numberPixels > 0) ? (double)sums[255] / numberPixels : 0.0;
+	}
+
+	/*****************************************************************************************************
+	 * Threshold selection
+	 *****************************************************************************************************/
+
+	/*! Isodata algorithm: Threshold is the center of background mean and foreground mean.
+	*
+	* Reference: W. Burger, M. Burge: Digitale Bildverarbeitung, 3. Auflage, Springer, S. 273.
+	*
+	* \return Threshold
+	*/
+	uchar ThresholdSelector::isodata(void) const {
+		int thresh = 0, lastThresh = -1;
+
+		// Init threshold at 50 % of pixels
+		while ((thresh < 255) && (counts[thresh] < numberPixels / 2))
+			thresh++;
+
+		// Iterate until threshold does not change anymore
+		for (int i = 0; (i < 256) && (thresh != lastThresh); i++) {
+			uint64_t numberBack = counts[thresh];
+			uint64_t numberFore = numberPixels - numberBack;
+
+			if ((numberBack == 0) || (numberFore == 0))
+				break;
+
+			double meanBack = (double)sums[thresh] / numberBack;
+			double meanFore = (double)(sums[255] - sums[thresh]) / numberFore;
+
+			lastThresh = thresh;
+			thresh = (int)(0.5 * (meanBack + meanFore));
+		}
+		return (uchar)thresh;
+	}
+
+	/*! Otsu's method: Threshold maximizes the variance between background and foreground.
+	*
+	* Reference: N. Otsu: A threshold selection method from gray-level histograms,
+	* IEEE Transactions on Systems, Man, and Cybernetics 9(1), 1979, pp. 62-66.
+	*
+	* \return Threshold
+	*/
+	uchar ThresholdSelector::otsu(void) const {
+		int bestThresh = getMinGray();
+		double maxVariance = -1.0;
+
+		for (int t = 0; t < 255; t++) {
+			double numberBack = (double)counts[t];
+			double numberFore = (double)(numberPixels - counts[t]);
+
+			if ((numberBack == 0.0) || (numberFore == 0.0))
+				continue;
+
+			// Between-class variance (scaled by number of pixels squared)
+			double meanDiff = sums[t] / numberBack - (sums[255] - sums[t]) / numberFore;
+			double variance = numberBack * numberFore * meanDiff * meanDiff;
+
+			if (variance > maxVariance) {
+				maxVariance = variance;
+				bestThresh = t;
+			}
+		}
+		return (uchar)bestThresh;
+	}
+
+	/*! Multi-level Otsu: Thresholds maximize the variance between several classes.
+	*
+	* Maximizing the between-class variance is equivalent to maximizing the sum of S_c^2 / N_c over
+	* all classes c with pixel counts N_c and gray-value sums S_c. The optimum is found by dynamic
+	* programming over the last gray-value of each class.
+	*
+	* \param numberThresholds [in] Number of thresholds (classes - 1)
+	* \param thresholds [out] Thresholds in ascending order (class i contains g in (t[i-1], t[i]])
+	*/
+	void ThresholdSelector::multiOtsu(int numberThresholds, vector<uchar>& thresholds) const {
+		thresholds.clear();
+		if ((numberThresholds < 1) || (numberThresholds > 255))
+			return;
+
+		// Class criterion S^2 / N for gray-values [first, last]
+		auto criterion = [&](int first, int last) {
+			uint64_t number = getCount(first, last);
+			double sum = (double)getSum(first, last);
+			return (number > 0) ? sum * sum / number : 0.0;
+		};
+
+		// best[j][t]: Optimum for gray-values [0, t] divided into j + 1 classes (last class ends at t)
+		vector<vector<double>> best(numberThresholds + 1, vector<double>(256, -1.0));
+		vector<vector<int>> lastEnds(numberThresholds + 1, vector<int>(256, -1));
+
+		for (int t = 0; t < 256; t++)
+			best[0][t] = criterion(0, t);
+
+		for (int j = 1; j <= numberThresholds; j++) {
+			for (int t = j; t < 256; t++) {
+				for (int s = j - 1; s < t; s++) {
+					double value = best[j - 1][s] + criterion(s + 1, t);
+
+					if (value > best[j][t]) {
+						best[j][t] = value;
+						lastEnds[j][t] = s;
+					}
+				}
+			}
+		}
+
+		// Trace back ends of classes
+		thresholds.resize(numberThresholds);
+		for (int j = numberThresholds, t = 255; j >= 1; j--) {
+			t = lastEnds[j][t];
+			thresholds[j - 1] = (uchar)t;
+		}
+	}
+
+	/*! Triangle algorithm: Threshold is the gray-value with largest distance between histogram and the
+	* line connecting the histogram peak with the end of the longer tail.
+	*
+	* Reference: G. W. Zack, W. E. Rogers, S. A. Latt: Automatic measurement of sister chromatid exchange
+	* frequency, Journal of Histochemistry and Cytochemistry 25(7), 1977, pp. 741-753.
+	*
+	* \return Threshold
+	*/
+	uchar ThresholdSelector::triangle(void) const {
+		// Peak and ends of histogram
+		int peak = 0;
+		for (int g = 1; g < 256; g++) {
+			if (histogram[g] > histogram[peak])
+				peak = g;
+		}
+
+		int first = std::max((int)getMinGray() - 1, 0);
+		int last = std::min((int)getMaxGray() + 1, 255);
+
+		// Line from peak to end of longer tail
+		bool isLeftTail = (peak - first > last - peak);
+		int lineEnd = isLeftTail ? first : last;
+		double height = (double)histogram[peak];
+		double dx = (double)(lineEnd - peak);
+		int bestThresh = peak;
+		double maxDistance = 0.0;
+
+		// Distance of histogram below line (scaled by line length)
+		for (int g = std::min(peak, lineEnd); g <= std::max(peak, lineEnd); g++) {
+			double lineHeight = (dx != 0.0) ? height * (1.0 - (g - peak) / dx) : height;
+			double distance = lineHeight - histogram[g];
+
+			if (distance > maxDistance) {
+				maxDistance = distance;
+				bestThresh = g;
+			}
+		}
+
+		return (uchar)bestThresh;
+	}
+
+	/*! Kapur's method: Threshold maximizes the sum of background entropy and foreground entropy.
+	*
+	* The entropy of a class with N pixels is H = ln(N) - sum(h(g) * ln(h(g))) / N.
+	*
+	* Reference: J. N. Kapur, P. K. Sahoo, A. K. C. Wong: A new method for gray-level picture
+	* thresholding using the entropy of the histogram, Computer Vision, Graphics, and Image Processing
+	* 29(3), 1985, pp. 273-285.
+	*
+	* \return Threshold
+	*/
+	uchar ThresholdSelector::kapur(void) const {
+		int bestThresh = getMinGray();
+		double maxEntropy = -DBL_MAX;
+
+		for (int t = 0; t < 255; t++) {
+			double numberBack = (double)counts[t];
+			double numberFore = (double)(numberPixels - counts[t]);
+
+			if ((numberBack == 0.0) || (numberFore == 0.0))
+				continue;
+
+			double entropyBack = log(numberBack) - entropies[t] / numberBack;
+			double entropyFore = log(numberFore) - (entropies[255] - entropies[t]) / numberFore;
+
+			if (entropyBack + entropyFore > maxEntropy) {
+				maxEntropy = entropyBack + entropyFore;
+				bestThresh = t;
+			}
+		}
+		return (uchar)bestThresh;
+	}
+}
@@ -0,0 +1,62 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_THRESHOLD_SELECTOR_H
+#define IP_THRESHOLD_SELECTOR_H
+
+/* Include files */
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/*! Select global thresholds from a single histogram.
+	*
+	* The histogram and prefix tables of pixel counts, gray-value sums, and entropy terms are calculated
+	* once. Each method then evaluates all 256 candidate thresholds in O(256) (multi-level Otsu in
+	* O(levels * 256^2)). All thresholds t separate background g <= t from foreground g > t.
+	*/
+	class ThresholdSelector {
+	private:
+		unsigned histogram[256];
+		uint64_t counts[256];		// Number of pixels with g <= t
+		uint64_t sums[256];			// Sum of gray-values g <= t
+		double entropies[256];		// Sum of h(g) * ln(h(g)) for g <= t
+		uint64_t numberPixels = 0;
+
+		void calcPrefixTables(void);
+		uint64_t getCount(int first, int last) const;
+		uint64_t getSum(int first, int last) const;
+
+	public:
+		ThresholdSelector(void);
+		ThresholdSelector(const cv::Mat& image);
+		void setImage(const cv::Mat& image);
+		void setHistogram(const unsigned histogram[256]);
+
+		// Histogram properties
+		const unsigned* getHistogram(void) const { return histogram; }
+		uint64_t getNumberPixels(void) const { return numberPixels; }
+		uchar getMinGray(void) const;
+		uchar getMaxGray(void) const;
+		double getMean(void) const;
+
+		// Threshold selection
+		uchar isodata(void) const;
+		uchar otsu(void) const;
+		void multiOtsu(int numberThresholds, std::vector<uchar>& thresholds) const;
+		uchar triangle(void) const;
+		uchar kapur(void) const;
+	};
+}
+
+#endif /* IP_THRESHOLD_SELECTOR_H */
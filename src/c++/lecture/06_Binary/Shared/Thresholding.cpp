@@ -4,15 +4,17 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
 /* Include files */
+#include <algorithm>
 #include <iostream>
 #include <opencv2/opencv.hpp>
 #include "Thresholding.h"
 #include "Histogram.h"
+#include "ThresholdSelector.h"
 
 /* Namespaces */
 using namespace std;
@@ -20,6 +22,10 @@ using namespace cv;
 
 namespace ip
 {
+	/* Prototypes (module internal) */
+	static void slidingMinMax(const uchar* src, int length, int radius, uchar* minDst, uchar* maxDst, vector<uchar>& buffer);
+	static void slidingMinMaxColumns(const Mat& srcMin, const Mat& srcMax, int radius, Mat& minDst, Mat& maxDst);
+
 	/*! Apply fixed global threshold.
 	*
 	* Resulting values are 0 (for g(x,y) <= thresh) and 255 (for g(x,y) > thresh).
@@ -45,30 +51,9 @@ namespace ip
 	* \param calculatedThresh [out] Threshold calculated and applied to image
 	*/
 	void isodataThreshold(const Mat& image, Mat& binImage, uchar* calculatedThresh) {
-		uchar thresh = 0, lastThresh = -1;
-		unsigned numberPixels = image.cols * image.rows;
-		unsigned histogram[256], cumulative[256], pixelSums[256];
-
-		// Calculate histogram and cumulative histogram
-		calcHistogram(image, histogram, cumulative);
-
-		// Calculate sums of pixel values
-		pixelSums[0] = 0;
-		for (int g = 1; g < 256; g++)
-			pixelSums[g] = pixelSums[g - 1] + g * histogram[g];
-
-		// Init threshold at 50 % of pixels
-		while (cumulative[thresh] < (numberPixels / 2))
-			thresh++;
-
-		// Threshold is center of background mean and foreground mean
-		while (thresh != lastThresh) {
-			double meanBack = (double)pixelSums[thresh] / (double)cumulative[thresh];
-			double meanFore = (double)(pixelSums[255] - pixelSums[thresh]) / (double)(numberPixels - cumulative[thresh]);
-
-			lastThresh = thresh;
-			thresh = (uchar)(0.5 * (meanBack + meanFore));
-		}
+		// Calculate histogram and threshold
+		ThresholdSelector selector(image);
+		uchar thresh = selector.isodata();
 
 		// Apply threshold
 		threshold(image, binImage, thresh, 255, THRESH_BINARY);
@@ -82,64 +67,479 @@ namespace ip
 	*
 	* Reference: W. Burger, M. Burge: Digitale Bildverarbeitung, 3. Auflage, Springer, S. 291.
 	*
-	* The implementation uses a squared instead of a circular neighborhood.
+	* Minimum and maximum of each neighborhood are calculated by the van Herk/Gil-Werman algorithm,
+	* which needs a constant number of comparisons per pixel independent of the window size:
+	* - Disk-shaped neighborhood: Each line of the disk is a 1D window on an image row. Within a band
+	*   of rows, each source row is filtered once per distinct line width (instead of once per line
+	*   of each output row). Combining the 2 * radius + 1 lines still costs O(radius) per pixel.
+	* - Squared neighborhood: The 2D window is separated into rows and columns. Costs are O(1) per pixel.
+	*
+	* Neighborhoods are cropped at the image borders. Image rows are processed in parallel bands.
 	*
 	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
 	* \param binImage [out] Resulting binary image with values in {0, 255}
-	* \param radius [in] Radius of the disk-sized neighborhood
+	* \param radius [in] Radius of the disk-sized neighborhood (or half width of the squared neighborhood)
 	* \param minContrast [in] Minimum contrast
 	* \param background [in] Gray-value of background in binary image
+	* \param isSquare [in] Use squared instead of disk-shaped neighborhood on true (O(1) per pixel)
 	*/
-	void bernsenThreshold(const Mat& image, Mat& binImage, int radius, uchar minContrast, uchar background) {
-		int kernelSize = 2 * radius + 1;
-		int* lineKernelSizes = new int[kernelSize] { 0 };
-
-		// Get half width dx = k for each line of the disk-sized neighborhood kernel
-		for (int dy = -radius; dy <= 0; dy++) {
-			for (int dx = -radius; dx <= 0; dx++) {
-				double distance = sqrt(dx * dx + dy * dy);
-
-				if (distance <= radius) {
-					lineKernelSizes[radius + dy] = -dx;
-					lineKernelSizes[radius - dy] = -dx;
-					break;
+	void bernsenThreshold(const Mat& image, Mat& binImage, int radius, uchar minContrast, uchar background, bool isSquare) {
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || (radius < 0))
+			return;
+
+		// Get half width k of each line dy of the disk-shaped neighborhood (k^2 + dy^2 <= radius^2)
+		vector<int> lineKernelSizes(2 * radius + 1);
+		for (int dy = -radius; dy <= radius; dy++) {
+			int k = radius;
+			while (k * k + dy * dy > radius * radius)
+				k--;
+			lineKernelSizes[radius + dy] = isSquare ? radius : k;
+		}
+
+		// Distinct half widths (lines dy and -dy share the same half width)
+		vector<int> lineWidths(lineKernelSizes.begin(), lineKernelSizes.end());
+		sort(lineWidths.begin(), lineWidths.end());
+		lineWidths.erase(unique(lineWidths.begin(), lineWidths.end()), lineWidths.end());
+
+		binImage.create(image.rows, image.cols, CV_8U);
+
+		// Process bands of rows in parallel
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			int cols = image.cols;
+			int firstRow = std::max(range.start - radius, 0);
+			int lastRow = std::min(range.end - 1 + radius, image.rows - 1);
+			Mat bandMin, bandMax;
+			vector<uchar> buffer;
+
+			// Squared neighborhood: Separable filter for complete band
+			if (isSquare) {
+				Mat rowsMin(range.size() + 2 * radius, cols, CV_8U), rowsMax(range.size() + 2 * radius, cols, CV_8U);
+
+				for (int i = 0; i < rowsMin.rows; i++) {
+					int y = std::min(std::max(range.start - radius + i, 0), image.rows - 1);
+					slidingMinMax(image.ptr<uchar>(y), cols, radius, rowsMin.ptr<uchar>(i), rowsMax.ptr<uchar>(i), buffer);
 				}
+				slidingMinMaxColumns(rowsMin, rowsMax, radius, bandMin, bandMax);
 			}
-		}
 
-		// Init binary image as "background"
-		binImage = background * Mat::ones(image.rows, image.cols, CV_8U);
+			// Disk-shaped neighborhood: Filter source rows once per line width and combine lines
+			else {
+				Mat rowsMin(lastRow - firstRow + 1, cols, CV_8U), rowsMax(lastRow - firstRow + 1, cols, CV_8U);
+				vector<int> rowWidths(rowsMin.rows, -1);	// Half width each source row is currently filtered with
 
-		// Run through image pixels
-		for (int y = radius; y < image.rows - radius; y++) {
-			const uchar* srcRow = image.ptr<uchar>(y);
-			uchar* dstRow = binImage.ptr<uchar>(y);
+				bandMin.create(range.size(), cols, CV_8U);
+				bandMax.create(range.size(), cols, CV_8U);
+				bandMin.setTo(255);
+				bandMax.setTo(0);
 
-			for (int x = radius; x < image.cols - radius; x++) {
-				// Determine minimum and maximum pixel value in neighborhood
-				uchar min = 255, max = 0;
+				for (int width : lineWidths) {
+					for (int dy = -radius; dy <= radius; dy++) {
+						if (lineKernelSizes[radius + dy] != width)
+							continue;
 
-				for (int v = y - radius; v <= y + radius; v++) {
-					const uchar* row = image.ptr<uchar>(v);
-					int k = lineKernelSizes[v - (y - radius)];
+						for (int y = std::max(range.start, -dy); y < std::min(range.end, image.rows - dy); y++) {
+							int i = y + dy - firstRow;
+							if (rowWidths[i] != width) {
+								slidingMinMax(image.ptr<uchar>(y + dy), cols, width, rowsMin.ptr<uchar>(i), rowsMax.ptr<uchar>(i), buffer);
+								rowWidths[i] = width;
+							}
 
-					for (int u = x - k; u <= x + k; u++) {
-						if (row[u] < min)
-							min = row[u];
-						else if (row[u] > max)
-							max = row[u];
+							const uchar* lineMins = rowsMin.ptr<uchar>(i);
+							const uchar* lineMaxs = rowsMax.ptr<uchar>(i);
+							uchar* mins = bandMin.ptr<uchar>(y - range.start);
+							uchar* maxs = bandMax.ptr<uchar>(y - range.start);
+
+							for (int x = 0; x < cols; x++) {
+								mins[x] = std::min(mins[x], lineMins[x]);
+								maxs[x] = std::max(maxs[x], lineMaxs[x]);
+							}
+						}
+					}
+				}
+			}
+
+			// Apply threshold
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				const uchar* minRow = bandMin.ptr<uchar>(y - range.start);
+				const uchar* maxRow = bandMax.ptr<uchar>(y - range.start);
+				uchar* dstRow = binImage.ptr<uchar>(y);
+
+				for (int x = 0; x < cols; x++) {
+					if (maxRow[x] - minRow[x] >= minContrast) {
+						uchar thresh = (minRow[x] + maxRow[x]) / 2;
+						dstRow[x] = (srcRow[x] > thresh) * 255;
 					}
+					else
+						dstRow[x] = background;
 				}
+			}
+		}, getNumThreads());
+	}
+
+	/*! Apply locally adaptive threshold based on local mean and standard deviation.
+	*
+	* Thresholds T(x,y) are calculated from mean m and standard deviation s in a squared window:
+	* - Niblack: T = m + k * s (use k < 0 for dark foreground on bright background, e.g., -0.2)
+	* - Sauvola: T = m * (1 + k * (s / R - 1)) with dynamic range R = 128 (e.g., k = 0.2 ... 0.5)
+	* - Wolf/Jolion: T = m - k * (1 - s / R) * (m - M) with minimum gray-value M of the image and
+	*   maximum R of all local standard deviations (e.g., k = 0.5)
+	*
+	* References:
+	* - J. Sauvola, M. Pietikainen: Adaptive document image binarization, Pattern Recognition 33(2), 2000, pp. 225-236.
+	* - C. Wolf, J.-M. Jolion: Extraction and recognition of artificial text in multimedia documents,
+	*   Pattern Analysis and Applications 6(4), 2003, pp. 309-326.
+	*
+	* Resulting values are 0 (for g(x,y) <= T(x,y)) and 255 (for g(x,y) > T(x,y)).
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param binImage [out] Resulting binary image with values in {0, 255}
+	* \param method [in] Method to calculate local thresholds with
+	* \param radius [in] Half window size (window size 2 * radius + 1)
+	* \param k [in] Weight of standard deviation
+	*/
+	void localThreshold(const Mat& image, Mat& binImage, LocalThresholdMethod method, int radius, double k) {
+		localThresholdParams params;
 
-				// Apply threshold
-				if (max - min >= minContrast) {
-					uchar thresh = (min + max) / 2;
+		params.method = method;
+		params.radius = radius;
+		params.k = k;
+		localThreshold(image, IntegralImage(image), binImage, params);
+	}
+
+	/*! Apply several locally adaptive thresholds based on local mean and standard deviation.
+	*
+	* The integral images are calculated once and shared by all parameter sets.
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param binImages [out] Resulting binary images with values in {0, 255} (one per parameter set)
+	* \param params [in] Parameter sets (method, window radius, k)
+	*/
+	void localThreshold(const Mat& image, vector<Mat>& binImages, const vector<localThresholdParams>& params) {
+		// Check image type
+		if (image.type() != CV_8U)
+			return;
+
+		IntegralImage integral(image);
+
+		binImages.resize(params.size());
+		for (size_t i = 0; i < params.size(); i++)
+			localThreshold(image, integral, binImages[i], params[i]);
+	}
+
+	/*! Apply locally adaptive threshold using precalculated integral images.
+	*
+	* Each row is processed in O(1) per pixel for any window size. Rows are processed in parallel.
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param integral [in] Integral images of the input image
+	* \param binImage [out] Resulting binary image with values in {0, 255}
+	* \param params [in] Method, window radius, and k
+	*/
+	void localThreshold(const Mat& image, const IntegralImage& integral, Mat& binImage, const localThresholdParams& params) {
+		const double SAUVOLA_RANGE = 128.0;
+
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || (integral.getRows() != image.rows) || (integral.getCols() != image.cols) || (params.radius < 0))
+			return;
+
+		// Wolf/Jolion: Minimum gray-value and maximum local standard deviation
+		double minGray = 0.0, maxStdDev = 1.0;
+
+		if (params.method == LocalThresholdMethod::WOLF) {
+			vector<double> rowMaxStdDevs(image.rows, 0.0);
+
+			minMaxLoc(image, &minGray);
+			parallel_for_(Range(0, image.rows), [&](const Range& range) {
+				for (int y = range.start; y < range.end; y++) {
+					for (int x = 0; x < image.cols; x++) {
+						double mean, stdDev;
+						integral.getMeanStdDev(x, y, params.radius, mean, stdDev);
+						rowMaxStdDevs[y] = std::max(rowMaxStdDevs[y], stdDev);
+					}
+				}
+			});
+			maxStdDev = std::max(*max_element(rowMaxStdDevs.begin(), rowMaxStdDevs.end()), 1.0e-6);
+		}
+
+		// Apply local thresholds
+		binImage.create(image.rows, image.cols, CV_8U);
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				uchar* dstRow = binImage.ptr<uchar>(y);
+
+				for (int x = 0; x < image.cols; x++) {
+					double mean, stdDev, thresh;
+					integral.getMeanStdDev(x, y, params.radius, mean, stdDev);
+
+					switch (params.method) {
+					case LocalThresholdMethod::NIBLACK:
+						thresh = mean + params.k * stdDev;
+						break;
+					case LocalThresholdMethod::SAUVOLA:
+						thresh = mean * (1.0 + params.k * (stdDev / SAUVOLA_RANGE - 1.0));
+						break;
+					default:
+						thresh = mean - params.k * (1.0 - stdDev / maxStdDev) * (mean - minGray);
+						break;
+					}
 					dstRow[x] = (srcRow[x] > thresh) * 255;
 				}
 			}
+		});
+	}
+
+	/*! Apply locally adaptive threshold interpolated between tiles.
+	*
+	* The image is divided into a grid of tiles. A threshold is calculated for each tile (in parallel)
+	* and assigned to the tile center. Thresholds between tile centers are bilinearly interpolated
+	* (and kept constant outside of the outer tile centers), so that there are no seams at tile borders.
+	* Interpolation and thresholding are done in a single pass.
+	*
+	* Tile statistics:
+	* - MID_RANGE: Center of minimum and maximum gray-value (min + max) / 2
+	* - MEAN: Mean gray-value
+	* - ISODATA: Threshold of isodata algorithm applied to the tile
+	*
+	* \param image [in] Input image g(x,y) to apply threshold to (type CV_8U)
+	* \param binImage [out] Resulting binary image with values in {0, 255}
+	* \param numberTiles [in] Number of tiles in x and y
+	* \param statistic [in] Statistic to calculate tile thresholds from
+	* \param thresholdSurface [out] Interpolated thresholds T(x,y) (type CV_32F, optional)
+	*/
+	void tileThreshold(const Mat& image, Mat& binImage, Size numberTiles, TileStatistic statistic, Mat* thresholdSurface) {
+		// Check image type and parameters
+		if ((image.type() != CV_8U) || image.empty() || (numberTiles.width < 1) || (numberTiles.height < 1))
+			return;
+
+		int tilesX = std::min(numberTiles.width, image.cols);
+		int tilesY = std::min(numberTiles.height, image.rows);
+
+		// Calculate tile thresholds (parallel over tiles)
+		Mat tileThresholds(tilesY, tilesX, CV_32F);
+
+		parallel_for_(Range(0, tilesX * tilesY), [&](const Range& range) {
+			for (int tile = range.start; tile < range.end; tile++) {
+				int kx = tile % tilesX, ky = tile / tilesX;
+				Rect roi(kx * image.cols / tilesX, ky * image.rows / tilesY, 0, 0);
+				roi.width = (kx + 1) * image.cols / tilesX - roi.x;
+				roi.height = (ky + 1) * image.rows / tilesY - roi.y;
+
+				// Tile histogram
+				unsigned histogram[256] = { 0 };
+				for (int y = roi.y; y < roi.y + roi.height; y++) {
+					const uchar* row = image.ptr<uchar>(y);
+					for (int x = roi.x; x < roi.x + roi.width; x++)
+						histogram[row[x]]++;
+				}
+
+				ThresholdSelector selector;
+				selector.setHistogram(histogram);
+
+				// Tile threshold
+				float thresh;
+				switch (statistic) {
+				case TileStatistic::MEAN:
+					thresh = (float)selector.getMean();
+					break;
+				case TileStatistic::ISODATA:
+					thresh = (float)selector.isodata();
+					break;
+				default:
+					thresh = 0.5f * ((float)selector.getMinGray() + (float)selector.getMaxGray());
+					break;
+				}
+				tileThresholds.at<float>(ky, kx) = thresh;
+			}
+		});
+
+		// Interpolation indices and weights for columns and rows (between neighboring tile centers)
+		auto getWeights = [](int length, int tiles, vector<int>& indices, vector<float>& weights) {
+			indices.resize(length);
+			weights.resize(length);
+
+			for (int i = 0; i < length; i++) {
+				// Position relative to tile centers c_k = (k + 0.5) * length / tiles
+				float position = (i + 0.5f) * tiles / length - 0.5f;
+				position = std::min(std::max(position, 0.0f), (float)(tiles - 1));
+				int index = std::min((int)position, std::max(tiles - 2, 0));
+
+				indices[i] = index;
+				weights[i] = (tiles > 1) ? position - index : 0.0f;
+			}
+		};
+
+		vector<int> indicesX, indicesY;
+		vector<float> weightsX, weightsY;
+		getWeights(image.cols, tilesX, indicesX, weightsX);
+		getWeights(image.rows, tilesY, indicesY, weightsY);
+
+		// Interpolate thresholds and apply them in a single pass (parallel over rows)
+		binImage.create(image.rows, image.cols, CV_8U);
+		if (thresholdSurface != NULL)
+			thresholdSurface->create(image.rows, image.cols, CV_32F);
+
+		parallel_for_(Range(0, image.rows), [&](const Range& range) {
+			vector<float> rowThresholds(tilesX + 1);
+
+			for (int y = range.start; y < range.end; y++) {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				uchar* dstRow = binImage.ptr<uchar>(y);
+				float* surfaceRow = (thresholdSurface != NULL) ? thresholdSurface->ptr<float>(y) : NULL;
+
+				// Interpolate tile thresholds vertically
+				int ky = indicesY[y];
+				float wy = weightsY[y];
+				const float* upperTiles = tileThresholds.ptr<float>(ky);
+				const float* lowerTiles = tileThresholds.ptr<float>(std::min(ky + 1, tilesY - 1));
+
+				for (int kx = 0; kx < tilesX; kx++)
+					rowThresholds[kx] = (1.0f - wy) * upperTiles[kx] + wy * lowerTiles[kx];
+				rowThresholds[tilesX] = rowThresholds[tilesX - 1];
+
+				// Interpolate horizontally and apply threshold
+				for (int x = 0; x < image.cols; x++) {
+					int kx = indicesX[x];
+					float wx = weightsX[x];
+					float thresh = (1.0f - wx) * rowThresholds[kx] + wx * rowThresholds[kx + 1];
+
+					dstRow[x] = (srcRow[x] > thresh) * 255;
+					if (surfaceRow != NULL)
+						surfaceRow[x] = thresh;
+				}
+			}
+		});
+	}
+
+	/*! Sliding minimum and maximum of a 1D signal (van Herk/Gil-Werman algorithm).
+	*
+	* The signal is divided into blocks of the window size w. Cumulative extrema from the start
+	* (g) and from the end (h) of each block are combined to min(h[x], g[x + w - 1]) for each window.
+	* Windows are cropped at the signal borders (equivalent to replicating the border values).
+	*
+	* Reference: M. van Herk: A fast algorithm for local minimum and maximum filters on rectangular
+	* and octagonal kernels, Pattern Recognition Letters 13(7), 1992, pp. 517-521.
+	*
+	* \param src [in] Signal
+	* \param length [in] Number of values in signal
+	* \param radius [in] Half window size (window size w = 2 * radius + 1)
+	* \param minDst [out] Sliding minimum
+	* \param maxDst [out] Sliding maximum
+	* \param buffer [in] Working memory (resized as needed)
+	*/
+	static void slidingMinMax(const uchar* src, int length, int radius, uchar* minDst, uchar* maxDst, vector<uchar>& buffer) {
+		int windowSize = 2 * radius + 1;
+		int paddedLength = length + 2 * radius;
+
+		buffer.resize(5 * (size_t)paddedLength);
+		uchar* padded = buffer.data();
+		uchar* gMin = padded + paddedLength;
+		uchar* hMin = gMin + paddedLength;
+		uchar* gMax = hMin + paddedLength;
+		uchar* hMax = gMax + paddedLength;
+
+		// Replicate border values
+		for (int i = 0; i < paddedLength; i++)
+			padded[i] = src[std::min(std::max(i - radius, 0), length - 1)];
+
+		// Cumulative extrema from start of each block
+		for (int i = 0; i < paddedLength; i++) {
+			bool isBlockStart = (i % windowSize == 0);
+			gMin[i] = isBlockStart ? padded[i] : std::min(gMin[i - 1], padded[i]);
+			gMax[i] = isBlockStart ? padded[i] : std::max(gMax[i - 1], padded[i]);
+		}
+
+		// Cumulative extrema from end of each block
+		for (int i = paddedLength - 1; i >= 0; i--) {
+			bool isBlockEnd = (i == paddedLength - 1) || ((i + 1) % windowSize == 0);
+			hMin[i] = isBlockEnd ? padded[i] : std::min(hMin[i + 1], padded[i]);
+			hMax[i] = isBlockEnd ? padded[i] : std::max(hMax[i + 1], padded[i]);
+		}
+
+		// Combine (window of x is [x, x + w - 1] in padded signal)
+		for (int x = 0; x < length; x++) {
+			minDst[x] = std::min(hMin[x], gMin[x + windowSize - 1]);
+			maxDst[x] = std::max(hMax[x], gMax[x + windowSize - 1]);
+		}
+	}
+
+	/*! Sliding minimum and maximum along columns (van Herk/Gil-Werman algorithm).
+	*
+	* Processes complete rows at once. The source rows must be padded by radius rows at the top and
+	* at the bottom. The results have 2 * radius rows less than the sources.
+	*
+	* \param srcMin [in] Rows to calculate the minimum for (type CV_8U)
+	* \param srcMax [in] Rows to calculate the maximum for (same size and type)
+	* \param radius [in] Half window size (window size w = 2 * radius + 1)
+	* \param minDst [out] Sliding minimum
+	* \param maxDst [out] Sliding maximum
+	*/
+	static void slidingMinMaxColumns(const Mat& srcMin, const Mat& srcMax, int radius, Mat& minDst, Mat& maxDst) {
+		int windowSize = 2 * radius + 1;
+		int paddedLength = srcMin.rows, cols = srcMin.cols;
+		Mat gMin(srcMin.size(), CV_8U), hMin(srcMin.size(), CV_8U), gMax(srcMin.size(), CV_8U), hMax(srcMin.size(), CV_8U);
+
+		// Cumulative extrema from start of each block
+		for (int i = 0; i < paddedLength; i++) {
+			const uchar* srcMinRow = srcMin.ptr<uchar>(i);
+			const uchar* srcMaxRow = srcMax.ptr<uchar>(i);
+			uchar* gMinRow = gMin.ptr<uchar>(i);
+			uchar* gMaxRow = gMax.ptr<uchar>(i);
+
+			if (i % windowSize == 0) {
+				memcpy(gMinRow, srcMinRow, cols);
+				memcpy(gMaxRow, srcMaxRow, cols);
+				continue;
+			}
+
+			const uchar* lastMinRow = gMin.ptr<uchar>(i - 1);
+			const uchar* lastMaxRow = gMax.ptr<uchar>(i - 1);
+			for (int x = 0; x < cols; x++) {
+				gMinRow[x] = std::min(lastMinRow[x], srcMinRow[x]);
+				gMaxRow[x] = std::max(lastMaxRow[x], srcMaxRow[x]);
+			}
+		}
+
+		// Cumulative extrema from end of each block
+		for (int i = paddedLength - 1; i >= 0; i--) {
+			const uchar* srcMinRow = srcMin.ptr<uchar>(i);
+			const uchar* srcMaxRow = srcMax.ptr<uchar>(i);
+			uchar* hMinRow = hMin.ptr<uchar>(i);
+			uchar* hMaxRow = hMax.ptr<uchar>(i);
+
+			if ((i == paddedLength - 1) || ((i + 1) % windowSize == 0)) {
+				memcpy(hMinRow, srcMinRow, cols);
+				memcpy(hMaxRow, srcMaxRow, cols);
+				continue;
+			}
+
+			const uchar* nextMinRow = hMin.ptr<uchar>(i + 1);
+			const uchar* nextMaxRow = hMax.ptr<uchar>(i + 1);
+			for (int x = 0; x < cols; x++) {
+				hMinRow[x] = std::min(nextMinRow[x], srcMinRow[x]);
+				hMaxRow[x] = std::max(nextMaxRow[x], srcMaxRow[x]);
+			}
 		}
 
-		// Free dynamic memory
-		delete[] lineKernelSizes;
+		// Combine
+		minDst.create(paddedLength - 2 * radius, cols, CV_8U);
+		maxDst.create(paddedLength - 2 * radius, cols, CV_8U);
+
+		for (int y = 0; y < minDst.rows; y++) {
+			const uchar* hMinRow = hMin.ptr<uchar>(y);
+			const uchar* hMaxRow = hMax.ptr<uchar>(y);
+			const uchar* gMinRow = gMin.ptr<uchar>(y + windowSize - 1);
+			const uchar* gMaxRow = gMax.ptr<uchar>(y + windowSize - 1);
+			uchar* minRow = minDst.ptr<uchar>(y);
+			uchar* maxRow = maxDst.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++) {
+				minRow[x] = std::min(hMinRow[x], gMinRow[x]);
+				maxRow[x] = std::max(hMaxRow[x], gMaxRow[x]);
+			}
+		}
 	}
-}
\ No newline at end of file
+}
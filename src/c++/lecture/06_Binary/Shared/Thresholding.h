@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -13,13 +13,31 @@
 #define IP_THRESHOLDING_H
 
 /* Include files */
+#include <vector>
 #include <opencv2/opencv.hpp>
+#include "IntegralImage.h"
 
 namespace ip
 {
+	/* Enumerations */
+	enum class LocalThresholdMethod { NIBLACK, SAUVOLA, WOLF };
+	enum class TileStatistic { MID_RANGE, MEAN, ISODATA };
+
+	/* Data structures */
+	typedef struct localThresholdParams {
+		LocalThresholdMethod method = LocalThresholdMethod::SAUVOLA;
+		int radius = 15;		// Half window size (window size 2 * radius + 1)
+		double k = 0.2;			// Weight of standard deviation
+	} localThresholdParams;
+
+	/* Prototypes */
 	void threshold(const cv::Mat& image, cv::Mat& binImage, uchar thresh, bool isInvert = false);
 	void isodataThreshold(const cv::Mat& image, cv::Mat& binImage, uchar* calculatedThresh = NULL);
-	void bernsenThreshold(const cv::Mat& image, cv::Mat& binImage, int radius, uchar minContrast, uchar background = 0);
+	void bernsenThreshold(const cv::Mat& image, cv::Mat& binImage, int radius, uchar minContrast, uchar background = 0, bool isSquare = false);
+	void localThreshold(const cv::Mat& image, cv::Mat& binImage, LocalThresholdMethod method, int radius, double k);
+	void localThreshold(const cv::Mat& image, std::vector<cv::Mat>& binImages, const std::vector<localThresholdParams>& params);
+	void localThreshold(const cv::Mat& image, const IntegralImage& integral, cv::Mat& binImage, const localThresholdParams& params);
+	void tileThreshold(const cv::Mat& image, cv::Mat& binImage, cv::Size numberTiles, TileStatistic statistic = TileStatistic::MID_RANGE, cv::Mat* thresholdSurface = NULL);
 }
 
 #endif /* IP_THRESHOLDING_H */
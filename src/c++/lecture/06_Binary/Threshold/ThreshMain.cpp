@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.11.27
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -16,6 +16,7 @@
 #include <opencv2/opencv.hpp>
 #include "Histogram.h"
 #include "Thresholding.h"
+#include "ThresholdSelector.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")					// Read environment variable ImagingData
@@ -30,6 +31,11 @@
 #define LOCAL_THRESH_MIN_CONTRAST 30
 #define LOCAL_THRESH_RADIUS 15
 #define BERNSEN_BACKGROUND 255
+#define MEAN_STDDEV_RADIUS 15
+#define NIBLACK_K -0.2
+#define SAUVOLA_K 0.2
+#define WOLF_K 0.5
+#define NUMBER_TILES 8
 
 /* Namespaces */
 using namespace std;
@@ -42,6 +48,8 @@ void onTrackbarLocalAdaptive(int valueNotUsed, void* pointerNotUsed);
 /* Global variables */
 Mat histogramImage;
 Mat image, binImageThresh, binImageGlobal, binImageLocal;
+vector<Mat> binImagesMeanStdDev;
+Mat binImageTiles;
 
 /* Main function */
 int main()
@@ -65,6 +73,25 @@ int main()
 	ip::isodataThreshold(image, binImageGlobal, &adaptiveThresh);
 	ip::bernsenThreshold(image, binImageLocal, LOCAL_THRESH_RADIUS, LOCAL_THRESH_MIN_CONTRAST, BERNSEN_BACKGROUND);
 
+	// Apply locally adaptive thresholds based on mean and standard deviation (sharing integral images)
+	vector<ip::localThresholdParams> meanStdDevParams(3);
+	meanStdDevParams[0] = { ip::LocalThresholdMethod::NIBLACK, MEAN_STDDEV_RADIUS, NIBLACK_K };
+	meanStdDevParams[1] = { ip::LocalThresholdMethod::SAUVOLA, MEAN_STDDEV_RADIUS, SAUVOLA_K };
+	meanStdDevParams[2] = { ip::LocalThresholdMethod::WOLF, MEAN_STDDEV_RADIUS, WOLF_K };
+	ip::localThreshold(image, binImagesMeanStdDev, meanStdDevParams);
+
+	// Apply locally adaptive threshold interpolated between tiles
+	ip::tileThreshold(image, binImageTiles, Size(NUMBER_TILES, NUMBER_TILES), ip::TileStatistic::ISODATA);
+
+	// Compare global thresholds selected from one histogram
+	ip::ThresholdSelector selector(image);
+	vector<uchar> multiOtsuThresholds;
+
+	selector.multiOtsu(2, multiOtsuThresholds);
+	cout << "Isodata: " << (int)selector.isodata() << ", Otsu: " << (int)selector.otsu()
+		<< ", Triangle: " << (int)selector.triangle() << ", Kapur: " << (int)selector.kapur()
+		<< ", Otsu (3 classes): " << (int)multiOtsuThresholds[0] << " / " << (int)multiOtsuThresholds[1] << endl;
+
 	// Draw adaptive global threshold in histogram image
 	ip::addLineToHistogramImage(histogramImage, adaptiveThresh);
 
@@ -74,6 +101,10 @@ int main()
 	imshow(WINDOW_NAME_THRESHOLD, binImageThresh);
 	imshow(string("Global adaptive (t = ").append(to_string(adaptiveThresh)).append(")"), binImageGlobal);
 	imshow(WINDOW_NAME_LOCAL, binImageLocal);
+	imshow("Niblack", binImagesMeanStdDev[0]);
+	imshow("Sauvola", binImagesMeanStdDev[1]);
+	imshow("Wolf/Jolion", binImagesMeanStdDev[2]);
+	imshow("Interpolated tiles (isodata)", binImageTiles);
 
 	// Add window sliders ("trackbars")
 	createTrackbar(TRACKBAR_NAME_THRESHOLD, WINDOW_NAME_THRESHOLD, NULL, 255, onTrackbarThreshold);
@@ -5,7 +5,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2024, Marc Hensel
- * Version: 2024.11.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -16,13 +16,16 @@
 #include <iostream>
 #include <opencv2/opencv.hpp>
 #include "BinaryRegions.h"
+#include "Contours.h"
+#include "HullGeometry.h"
+#include "Reconstruction.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")					// Read environment variable ImagingData
 #define INPUT_IMAGE_RELATIVE_PATH "/images/misc/Hardware.jpg"	// Image file including relative path
 
 #define BINARY_THRESHOLD 80
-#define MORPH_SIZE 5
+#define MIN_BLOB_AREA 250
 #define IS_INVERT_BINARY false
 #define IS_SAVE_FILES false
 
@@ -47,29 +50,51 @@ int main()
 	Mat binary;
 	threshold(image, binary, BINARY_THRESHOLD, 255, threshMethod);
 
-	// Remove small BLOBS
-	Mat structure = getStructuringElement(MORPH_RECT, Size(MORPH_SIZE, MORPH_SIZE));
-	morphologyEx(binary, binary, MORPH_CLOSE, structure);
-	morphologyEx(binary, binary, MORPH_OPEN, structure);
+	// Remove small BLOBS and fill holes (without changing shapes of remaining BLOBS)
+	ip::areaOpening(binary, binary, MIN_BLOB_AREA);
+	ip::fillHoles(binary, binary);
 
-	// Region labeling
-	Mat labeled = binary.clone() / 255;		// => Values in [0, 1]
-	Mat labeledRGB;
-	ip::labelRegions(labeled);
+	// Region labeling (32-bit labels)
+	Mat labeled, labeledRGB;
+	ip::labelRegions(binary, labeled);
 	ip::labels2RGB(labeled, labeledRGB);
 
-	// Annotate BLOB statistics
-	ip::blob blobs[256];
-	ip::labels2BlobFeatures(labeled, blobs);
+	// Annotate BLOB statistics (single pass over binary image, BLOB i has label i + 1)
+	vector<ip::blob> blobs;
+	ip::analyzeBlobs(binary, blobs);
 	ip::annotateBlobs(labeledRGB, blobs);
 
+	// Trace outer contours of labeled regions (contour i has label i + 1)
+	vector<ip::contour> contours;
+	vector<uchar> chainCodes;
+	ip::traceLabelContours(labeled, contours, chainCodes);
+
+	// Hull measures of contours (minimum-area rectangles, Feret diameters, solidity)
+	vector<ip::hullMeasures> hulls;
+	ip::hullGeometry(contours, chainCodes, hulls);
+
+	for (const ip::hullMeasures& hull : hulls) {
+		Point2f corners[4];
+		hull.minAreaRect.points(corners);
+		for (int k = 0; k < 4; k++)
+			line(labeledRGB, corners[k], corners[(k + 1) % 4], Scalar(255, 255, 255));
+	}
+
+	// Print shape descriptors derived from BLOB moments, contours, and convex hulls
+	cout << "Label\tArea\tOrientation\tEccentricity\tCircularity\tMin Feret\tMax Feret\tSolidity" << endl;
+	for (size_t i = 0; i < blobs.size(); i++) {
+		double angle = blobs[i].moments.getOrientation() * 180.0 / CV_PI;
+		cout << i + 1 << "\t" << blobs[i].size << "\t" << angle << "\t" << blobs[i].moments.getEccentricity() << "\t" << contours[i].circularity;
+		cout << "\t" << hulls[i].minFeret << "\t" << hulls[i].maxFeret << "\t" << hulls[i].solidity << endl;
+	}
+
 	// Display images
 	imshow("Image", image);
 	imshow("Labeled (colored)", labeledRGB);
 
 	// Save images to files
 #if IS_SAVE_FILES == true
-	string suffix = string("_t").append(to_string(BINARY_THRESHOLD)).append("_k").append(to_string(MORPH_SIZE)).append(".jpg");
+	string suffix = string("_t").append(to_string(BINARY_THRESHOLD)).append("_a").append(to_string(MIN_BLOB_AREA)).append(".jpg");
 	imwrite(string("D:/_Annotated").append(suffix), labeledRGB);
 #endif
 
@@ -4,13 +4,16 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
 /* Include files */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
-#include <queue>
+#include <vector>
 #include "BinaryRegions.h"
 
 /* Namespaces */
@@ -19,6 +22,17 @@ using namespace cv;
 
 namespace ip
 {
+	/* Prototypes (module internal) */
+	template <typename ParentArray>
+	static int labelRows(const Mat& binImage, Mat& labelImage, int rowStart, int rowEnd, int connectivity, ParentArray& parents, int firstLabel);
+	static void relabel(Mat& labelImage, const vector<int>& finalLabels);
+	template <typename ParentArray>
+	static int findRoot(ParentArray& parents, int label);
+	template <typename ParentArray>
+	static int unite(ParentArray& parents, int labelA, int labelB);
+	static void uniteConcurrent(vector<atomic<int>>& parents, int labelA, int labelB);
+	static void annotateBlob(Mat& rgbImage, const blob& blobInfo, int label);
+
 	/*! Label regions in binary image.
 	* 
 	* Resulting image will have following pixel values:
@@ -49,49 +63,374 @@ namespace ip
 		}
 	}
 
-	/*! Fills binary object using flood fill.
-	* 
-	* - The implemtation uses a breadth-first approach with N4 neighborhood.
-	* - Unlabeled pixels are supposed to have the value 1.
-	* 
-	* \param binImage [in/out] Binary image to label region in
+	/*! Label regions in binary image by a two-pass algorithm with union-find.
+	*
+	* 1. First pass: Each region pixel gets the label of an already scanned neighbor or a new
+	*    provisional label. If scanned neighbors have different labels, these are united in a flat
+	*    union-find array. Roots are always the smaller label, so that each label's parent precedes it.
+	* 2. Resolve: Roots get consecutive labels 1 to N in the order of their first pixels (raster order).
+	*    All other labels get the label of their parent.
+	* 3. Second pass: Replace provisional labels by final labels.
+	*
+	* Other than labelRegions() for 8-bit images, the number of regions is not limited to 254.
+	*
+	* \param binImage [in] Binary image (type CV_8U, regions are pixels with values not 0)
+	* \param labelImage [out] Labels 1 to N of regions and 0 for background (type CV_32S)
+	* \param connectivity [in] Neighborhood (4 or 8)
+	* \return Number N of regions
+	*/
+	int labelRegions(const Mat& binImage, Mat& labelImage, int connectivity) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return 0;
+
+		// 1. First pass: Provisional labels and equivalences (new labels are never adjacent in a row)
+		int rows = binImage.rows, cols = binImage.cols;
+		vector<int> parents((size_t)rows * ((cols + 1) / 2) + 1, 0);		// Label 0 is background
+
+		labelImage.create(rows, cols, CV_32S);
+		int endLabel = labelRows(binImage, labelImage, 0, rows, connectivity, parents, 1);
+
+		// 2. Resolve: Consecutive labels for roots (parents precede their children)
+		vector<int> finalLabels(endLabel, 0);
+		int numberLabels = 0;
+
+		for (int label = 1; label < endLabel; label++)
+			finalLabels[label] = (parents[label] == label) ? ++numberLabels : finalLabels[parents[label]];
+
+		// 3. Second pass: Final labels
+		relabel(labelImage, finalLabels);
+		return numberLabels;
+	}
+
+	/*! Label regions in binary image in parallel horizontal stripes.
+	*
+	* 1. Stripes: Each stripe is labeled by the first pass of labelRegions() on a worker thread. The
+	*    stripes use disjoint ranges of provisional labels in a common union-find array.
+	* 2. Merge: Labels of neighboring pixels across stripe borders are united by a lock-free
+	*    union-find (roots are linked by compare-and-swap). The stripe borders are merged in parallel.
+	* 3. Resolve: Roots are counted per stripe and get consecutive labels by the stripe's offset.
+	* 4. Second pass: Replace provisional labels by final labels (rows in parallel).
+	*
+	* The root of each region is its smallest provisional label, which is the label of its first pixel
+	* in raster order. The result is therefore identical to labelRegions().
+	*
+	* \param binImage [in] Binary image (type CV_8U, regions are pixels with values not 0)
+	* \param labelImage [out] Labels 1 to N of regions and 0 for background (type CV_32S)
+	* \param connectivity [in] Neighborhood (4 or 8)
+	* \return Number N of regions
+	*/
+	int labelRegionsParallel(const Mat& binImage, Mat& labelImage, int connectivity) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return 0;
+
+		// Stripes and their ranges of provisional labels (new labels are never adjacent in a row)
+		int rows = binImage.rows, cols = binImage.cols;
+		int labelsPerRow = (cols + 1) / 2;
+		int numberStripes = std::max(1, std::min(getNumThreads(), rows));
+		vector<int> stripeRows(numberStripes + 1), endLabels(numberStripes);
+		vector<atomic<int>> parents((size_t)rows * labelsPerRow + 1);
+
+		for (int stripe = 0; stripe <= numberStripes; stripe++)
+			stripeRows[stripe] = (int)((int64_t)stripe * rows / numberStripes);
+
+		// 1. Stripes: Provisional labels and equivalences
+		labelImage.create(rows, cols, CV_32S);
+		parallel_for_(Range(0, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				int firstLabel = stripeRows[stripe] * labelsPerRow + 1;
+				endLabels[stripe] = labelRows(binImage, labelImage, stripeRows[stripe], stripeRows[stripe + 1], connectivity, parents, firstLabel);
+			}
+		}, numberStripes);
+
+		// 2. Merge: Unite labels across stripe borders
+		parallel_for_(Range(1, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				int y = stripeRows[stripe];
+				const int* row = labelImage.ptr<int>(y);
+				const int* lastRow = labelImage.ptr<int>(y - 1);
+
+				for (int x = 0; x < cols; x++) {
+					if (row[x] == 0)
+						continue;
+
+					for (int dx = -1; dx <= 1; dx++) {
+						int xUp = x + dx;
+						if ((xUp < 0) || (xUp >= cols) || ((connectivity == 4) && (dx != 0)) || (lastRow[xUp] == 0))
+							continue;
+						uniteConcurrent(parents, row[x], lastRow[xUp]);
+					}
+				}
+			}
+		});
+
+		// 3. Resolve: Count roots per stripe, add offsets, and copy labels of roots to other labels
+		vector<int> finalLabels(parents.size(), 0);
+		vector<int> offsets(numberStripes + 1, 0);
+
+		parallel_for_(Range(0, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				int numberRoots = 0;
+				for (int label = stripeRows[stripe] * labelsPerRow + 1; label < endLabels[stripe]; label++) {
+					if (parents[label] == label)
+						finalLabels[label] = ++numberRoots;
+				}
+				offsets[stripe + 1] = numberRoots;
+			}
+		}, numberStripes);
+
+		for (int stripe = 0; stripe < numberStripes; stripe++)
+			offsets[stripe + 1] += offsets[stripe];
+
+		parallel_for_(Range(0, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				for (int label = stripeRows[stripe] * labelsPerRow + 1; label < endLabels[stripe]; label++) {
+					if (parents[label] == label)
+						finalLabels[label] += offsets[stripe];
+				}
+			}
+		}, numberStripes);
+
+		parallel_for_(Range(0, numberStripes), [&](const Range& range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				for (int label = stripeRows[stripe] * labelsPerRow + 1; label < endLabels[stripe]; label++) {
+					if (parents[label] != label)
+						finalLabels[label] = finalLabels[findRoot(parents, label)];
+				}
+			}
+		}, numberStripes);
+
+		// 4. Second pass: Final labels
+		relabel(labelImage, finalLabels);
+		return offsets[numberStripes];
+	}
+
+	/*! First pass of two-pass labeling for a range of rows.
+	*
+	* Rows above the range are ignored. New provisional labels are assigned in ascending order,
+	* starting with the first label.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param labelImage [in/out] Provisional labels (type CV_32S)
+	* \param rowStart [in] First row to label
+	* \param rowEnd [in] Row after last row to label
+	* \param connectivity [in] Neighborhood (4 or 8)
+	* \param parents [in/out] Union-find array of labels (large enough for all new labels)
+	* \param firstLabel [in] First provisional label to assign
+	* \return Label after last assigned provisional label
+	*/
+	template <typename ParentArray>
+	static int labelRows(const Mat& binImage, Mat& labelImage, int rowStart, int rowEnd, int connectivity, ParentArray& parents, int firstLabel) {
+		int cols = binImage.cols;
+		int nextLabel = firstLabel;
+
+		for (int y = rowStart; y < rowEnd; y++) {
+			const uchar* srcRow = binImage.ptr<uchar>(y);
+			int* dstRow = labelImage.ptr<int>(y);
+			const int* lastRow = (y > rowStart) ? labelImage.ptr<int>(y - 1) : NULL;
+
+			for (int x = 0; x < cols; x++) {
+				if (srcRow[x] == 0) {
+					dstRow[x] = 0;
+					continue;
+				}
+
+				// Labels of scanned neighbors
+				int left = (x > 0) ? dstRow[x - 1] : 0;
+				int up = (lastRow != NULL) ? lastRow[x] : 0;
+				int label;
+
+				if (connectivity == 4) {
+					label = (up > 0) ? up : left;
+					if ((up > 0) && (left > 0) && (up != left))
+						label = unite(parents, up, left);
+				}
+				else if (up > 0) {
+					// Left and upper neighbors are connected to the upper neighbor already
+					label = up;
+				}
+				else {
+					int upLeft = ((lastRow != NULL) && (x > 0)) ? lastRow[x - 1] : 0;
+					int upRight = ((lastRow != NULL) && (x < cols - 1)) ? lastRow[x + 1] : 0;
+					int leftSide = (left > 0) ? left : upLeft;
+
+					label = (upRight > 0) ? upRight : leftSide;
+					if ((upRight > 0) && (leftSide > 0) && (upRight != leftSide))
+						label = unite(parents, upRight, leftSide);
+				}
+
+				// No labeled neighbor => New provisional label
+				if (label == 0) {
+					label = nextLabel++;
+					parents[label] = label;
+				}
+				dstRow[x] = label;
+			}
+		}
+
+		return nextLabel;
+	}
+
+	/*! Replace provisional labels by final labels (rows in parallel).
+	*
+	* \param labelImage [in/out] Labels (type CV_32S)
+	* \param finalLabels [in] Final label of each provisional label
+	*/
+	static void relabel(Mat& labelImage, const vector<int>& finalLabels) {
+		parallel_for_(Range(0, labelImage.rows), [&](const Range& range) {
+			for (int y = range.start; y < range.end; y++) {
+				int* row = labelImage.ptr<int>(y);
+
+				for (int x = 0; x < labelImage.cols; x++)
+					row[x] = finalLabels[row[x]];
+			}
+		});
+	}
+
+	/*! Find root of a union-find tree (with path halving).
+	*
+	* \param parents [in/out] Parent label of each label
+	* \param label [in] Label to find root of
+	* \return Root label
+	*/
+	template <typename ParentArray>
+	static int findRoot(ParentArray& parents, int label) {
+		int parent = parents[label];
+
+		while (parent != label) {
+			int grandParent = parents[parent];
+			parents[label] = grandParent;
+			label = grandParent;
+			parent = parents[label];
+		}
+		return label;
+	}
+
+	/*! Unite the trees of two labels. The larger root is linked to the smaller one.
+	*
+	* \param parents [in/out] Parent label of each label
+	* \param labelA [in] First label
+	* \param labelB [in] Second label
+	* \return Root label of united tree
+	*/
+	template <typename ParentArray>
+	static int unite(ParentArray& parents, int labelA, int labelB) {
+		int rootA = findRoot(parents, labelA);
+		int rootB = findRoot(parents, labelB);
+
+		if (rootA < rootB) {
+			parents[rootB] = rootA;
+			return rootA;
+		}
+		parents[rootA] = rootB;
+		return rootB;
+	}
+
+	/*! Unite the trees of two labels while other threads may do the same.
+	*
+	* The larger root is linked to the smaller one by compare-and-swap. If the root got another parent
+	* in the meantime, the roots are searched again. Path halving only replaces parents by ancestors
+	* and is therefore safe without locks.
+	*
+	* \param parents [in/out] Parent label of each label
+	* \param labelA [in] First label
+	* \param labelB [in] Second label
+	*/
+	static void uniteConcurrent(vector<atomic<int>>& parents, int labelA, int labelB) {
+		while (true) {
+			int rootA = findRoot(parents, labelA);
+			int rootB = findRoot(parents, labelB);
+			if (rootA == rootB)
+				return;
+
+			int larger = std::max(rootA, rootB), smaller = std::min(rootA, rootB);
+			if (parents[larger].compare_exchange_strong(larger, smaller))
+				return;
+		}
+	}
+
+	/*! Fills binary object using scanline flood fill.
+	*
+	* - The region consists of the connected pixels having the value of the start pixel.
+	* - Each horizontal run ("span") of region pixels is filled at once. Only the ranges of the rows
+	*   above and below the span are pushed as seeds, not single pixels.
+	* - Unlabeled pixels are supposed to have the value 1, when called by labelRegions().
+	*
+	* \param binImage [in/out] Binary image to label region in (type CV_8U)
 	* \param x [in] Location (x,y) of a pixel of the region to label
 	* \param y [in] Location (x,y) of a pixel of the region to label
 	* \param label [in] Value to assign to the binary region
+	* \param connectivity [in] Neighborhood (4 or 8)
+	* \param boundingBox [out] Bounding box of the filled region (ignored if NULL)
+	* \return Number of filled pixels
 	*/
-	void floodFill(Mat& binImage, int x, int y, uchar label) {
-		queue<Point> q;
-
-		// Init queue with first pixel location of BLOB
-		q.push(Point(x, y));
-
-		// Process queue
-		while (!q.empty()) {
-			// Get and remove next pixel location
-			x = q.front().x;
-			y = q.front().y;
-			q.pop();
-
-			// Is pixel new BLOB pixel?
-			if ((x >= 0) && (x < binImage.cols) && (y >= 0) && (y < binImage.rows) && binImage.at<uchar>(y, x) == 1) {
-				// Mark as BLOB pixel
-				binImage.at<uchar>(y, x) = label;
-
-				// Add 4-neighbors to queue
-				q.push(cv::Point(x + 1, y));
-				q.push(cv::Point(x, y + 1));
-				q.push(cv::Point(x, y - 1));
-				q.push(cv::Point(x - 1, y));
+	unsigned floodFill(Mat& binImage, int x, int y, uchar label, int connectivity, Rect2i* boundingBox) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || (x < 0) || (x >= binImage.cols) || (y < 0) || (y >= binImage.rows))
+			return 0;
+		if (((connectivity != 4) && (connectivity != 8)) || (binImage.at<uchar>(y, x) == label))
+			return 0;
+
+		// Seeds: Range of columns [x0, x1] in a row to search region pixels in
+		typedef struct seedSpan { int y, x0, x1; } seedSpan;
+		vector<seedSpan> stack;
+		stack.reserve(2 * binImage.rows + 2);
+		stack.push_back({ y, x, x });
+
+		uchar value = binImage.at<uchar>(y, x);
+		int reach = (connectivity == 8) ? 1 : 0;	// Spans in neighboring rows overlap diagonally in N8
+		int minX = x, maxX = x, minY = y, maxY = y;
+		unsigned area = 0;
+
+		// Process stack
+		while (!stack.empty()) {
+			seedSpan seed = stack.back();
+			stack.pop_back();
+			uchar* row = binImage.ptr<uchar>(seed.y);
+
+			for (int xs = seed.x0; xs <= seed.x1; xs++) {
+				if (row[xs] != value)
+					continue;
+
+				// Extend span to the left and right and fill it
+				int left = xs, right = xs;
+				while ((left > 0) && (row[left - 1] == value))
+					left--;
+				while ((right < binImage.cols - 1) && (row[right + 1] == value))
+					right++;
+
+				std::fill(row + left, row + right + 1, label);
+				area += right - left + 1;
+				minX = std::min(minX, left);
+				maxX = std::max(maxX, right);
+				minY = std::min(minY, seed.y);
+				maxY = std::max(maxY, seed.y);
+
+				// Push ranges of neighboring rows
+				int x0 = std::max(left - reach, 0);
+				int x1 = std::min(right + reach, binImage.cols - 1);
+				if (seed.y > 0)
+					stack.push_back({ seed.y - 1, x0, x1 });
+				if (seed.y < binImage.rows - 1)
+					stack.push_back({ seed.y + 1, x0, x1 });
+
+				xs = right + 1;
 			}
 		}
+
+		if (boundingBox != NULL)
+			*boundingBox = Rect2i(minX, minY, maxX - minX + 1, maxY - minY + 1);
+		return area;
 	}
 
 	/*! Created RGB image with regions displayed in different colors.
 	*
 	* Regions are defined by the numeric value in the input image.
 	* The background (region value = 0) is set to white.
+	* Labels of 32-bit images are mapped cyclically to the 255 region colors.
 	*
-	* \param labelImage [in] Input image containing regions (i. e., connected sets with same value > 0)
+	* \param labelImage [in] Input image containing regions (type CV_8U or CV_32S)
 	* \param rgbImage [out] Image with regions having different colors
 	*/
 	void labels2RGB(const Mat& labelImage, Mat& rgbImage) {
@@ -117,11 +456,22 @@ namespace ip
 		rgbImage = Mat(Size(labelImage.cols, labelImage.rows), CV_8UC3);
 
 		for (int y = 0; y < labelImage.rows; y++) {
-			const uchar* srcRow = labelImage.ptr<uchar>(y);
 			Vec3b* dstRow = rgbImage.ptr<Vec3b>(y);
 
-			for (int x = 0; x < labelImage.cols; x++) {
-				dstRow[x] = colors.at<Vec3b>(srcRow[x]);
+			if (labelImage.type() == CV_32S) {
+				const int* srcRow = labelImage.ptr<int>(y);
+
+				for (int x = 0; x < labelImage.cols; x++) {
+					int label = srcRow[x];
+					dstRow[x] = colors.at<Vec3b>((label > 0) ? (label - 1) % 255 + 1 : 0);
+				}
+			}
+			else {
+				const uchar* srcRow = labelImage.ptr<uchar>(y);
+
+				for (int x = 0; x < labelImage.cols; x++) {
+					dstRow[x] = colors.at<Vec3b>(srcRow[x]);
+				}
 			}
 		}
 	}
@@ -135,6 +485,7 @@ namespace ip
 	* - size (i. e., number of pixels with label)
 	* - center of gravity
 	* - bounding box
+	* - raw moments up to third order
 	* 
 	* \param labelImage [in] Input image containing regions (i. e., connected sets with same value > 0)
 	* \param labelImage [out] Statistical values corresponding to BLOBs
@@ -157,20 +508,21 @@ namespace ip
 				uchar label = srcRow[x];
 
 				if (label > 0) {
-					// Size and center of gravity
+					// Size, center of gravity, and moments
 					blobs[label].size++;
 					blobs[label].cog.x += x;
 					blobs[label].cog.y += y;
+					blobs[label].moments.addPixel(x, y);
 
-					// Bounding box
+					// Bounding box (first pixel of a label can update minimum and maximum)
 					if (x < minX[label])
 						minX[label] = x;
-					else if (x > maxX[label])
+					if (x > maxX[label])
 						maxX[label] = x;
 
 					if (y < minY[label])
 						minY[label] = y;
-					else if (y > maxY[label])
+					if (y > maxY[label])
 						maxY[label] = y;
 				}
 			}
@@ -192,6 +544,116 @@ namespace ip
 		}
 	}
 
+	/*! Determine BLOB features in a single pass over a binary image (without label image).
+	*
+	* Each row is split into runs of region pixels. A run gets the provisional label of an overlapping
+	* run in the previous row or a new label. Labels of further overlapping runs are united in a
+	* union-find array, and their statistics are added to the root. Each run's statistics are added in
+	* closed form (e.g., sum of x over the run). Only the runs of the previous row and the statistics
+	* per provisional label are stored.
+	*
+	* Implemented features:
+	* - size (i. e., number of pixels)
+	* - center of gravity
+	* - bounding box
+	* - raw moments up to third order (see RegionMoments for derived shape descriptors)
+	*
+	* The BLOBs are ordered by their first pixel in raster order, so that blobs[i] is the region
+	* with label i + 1 of labelRegions() for 32-bit label images.
+	*
+	* \param binImage [in] Binary image (type CV_8U, regions are pixels with values not 0)
+	* \param blobs [out] Statistical values of BLOBs
+	* \param connectivity [in] Neighborhood (4 or 8)
+	*/
+	void analyzeBlobs(const Mat& binImage, vector<blob>& blobs, int connectivity) {
+		blobs.clear();
+
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return;
+
+		// Runs of current and previous row, and statistics by provisional label
+		typedef struct pixelRun { int x0, x1, label; } pixelRun;
+		vector<pixelRun> runs, lastRuns;
+		vector<int> parents;
+		vector<blob> stats;
+		vector<Point> minPoints, maxPoints;
+		int reach = (connectivity == 8) ? 1 : 0;	// Runs in neighboring rows overlap diagonally in N8
+
+		for (int y = 0; y < binImage.rows; y++) {
+			const uchar* row = binImage.ptr<uchar>(y);
+			size_t next = 0;					// First run of previous row that may overlap
+			runs.clear();
+
+			for (int x = 0; x < binImage.cols; x++) {
+				if (row[x] == 0)
+					continue;
+
+				// Run [x0, x1]
+				int x0 = x;
+				while ((x + 1 < binImage.cols) && (row[x + 1] != 0))
+					x++;
+				int x1 = x;
+
+				// Skip runs of previous row left of run and unite overlapping ones
+				while ((next < lastRuns.size()) && (lastRuns[next].x1 < x0 - reach))
+					next++;
+
+				int label = -1;
+				for (size_t i = next; (i < lastRuns.size()) && (lastRuns[i].x0 <= x1 + reach); i++) {
+					int root = findRoot(parents, lastRuns[i].label);
+
+					if (label < 0)
+						label = root;
+					else if (root != label) {
+						int merged = std::min(label, root), other = std::max(label, root);
+						parents[other] = merged;
+
+						// Add statistics of other root to merged root
+						stats[merged].size += stats[other].size;
+						stats[merged].moments.add(stats[other].moments);
+						minPoints[merged].x = std::min(minPoints[merged].x, minPoints[other].x);
+						minPoints[merged].y = std::min(minPoints[merged].y, minPoints[other].y);
+						maxPoints[merged].x = std::max(maxPoints[merged].x, maxPoints[other].x);
+						maxPoints[merged].y = std::max(maxPoints[merged].y, maxPoints[other].y);
+						label = merged;
+					}
+				}
+
+				// No overlapping run => New provisional label
+				if (label < 0) {
+					label = (int)parents.size();
+					parents.push_back(label);
+					stats.push_back(blob());
+					minPoints.push_back(Point(x0, y));
+					maxPoints.push_back(Point(x1, y));
+				}
+
+				// Add run to statistics (moments in closed form)
+				stats[label].size += x1 - x0 + 1;
+				stats[label].moments.addRun(x0, x1, y);
+				minPoints[label].x = std::min(minPoints[label].x, x0);
+				maxPoints[label].x = std::max(maxPoints[label].x, x1);
+				maxPoints[label].y = y;
+
+				runs.push_back({ x0, x1, label });
+			}
+			lastRuns.swap(runs);
+		}
+
+		// Collect roots (provisional labels in order of their first pixels)
+		for (int label = 0; label < (int)parents.size(); label++) {
+			if (parents[label] != label)
+				continue;
+
+			blob result = stats[label];
+			Point2d centroid = result.moments.getCentroid();
+			result.cog = Point((int)(centroid.x + 0.5), (int)(centroid.y + 0.5));
+			result.boundingBox = Rect2i(minPoints[label], maxPoints[label] + Point(1, 1));
+			blobs.push_back(result);
+		}
+	}
+
 	/*! Draw blob informatin to RGB image.
 	*
 	* Implemented features:
@@ -203,24 +665,44 @@ namespace ip
 	* \param blobs [in] Information to draw on image
 	*/
 	void annotateBlobs(Mat& rgbImage, const blob blobs[256]) {
-		Scalar BLACK = Scalar(0, 0, 0);
-		Scalar RED = Scalar(0, 0, 255);
-
 		// Run through labels (BLOBs)
 		for (int label = 0; label < 256; label++) {
 
 			// Region with label exists => Annotate
-			if (blobs[label].size > 0) {
-				Rect box = blobs[label].boundingBox;
-
-				circle(rgbImage, blobs[label].cog, 1, BLACK, 2);
-				rectangle(rgbImage, box, RED, 1);
-				putText(
-					rgbImage,
-					to_string(label),
-					Point(box.x + box.width, box.y),
-					FONT_HERSHEY_PLAIN, 1.0, RED, 1);
-			}
+			if (blobs[label].size > 0)
+				annotateBlob(rgbImage, blobs[label], label);
 		}
 	}
+
+	/*! Draw blob information to RGB image.
+	*
+	* BLOBs are annotated with labels 1 to N by their index (see analyzeBlobs()).
+	*
+	* \param rgbImage [in/out] Image to draw on (typically contains regions corresponding to parameter blobs)
+	* \param blobs [in] Information to draw on image
+	*/
+	void annotateBlobs(Mat& rgbImage, const vector<blob>& blobs) {
+		for (size_t i = 0; i < blobs.size(); i++)
+			annotateBlob(rgbImage, blobs[i], (int)i + 1);
+	}
+
+	/*! Draw information of a single blob to RGB image.
+	*
+	* \param rgbImage [in/out] Image to draw on
+	* \param blobInfo [in] Information to draw on image
+	* \param label [in] Label to display
+	*/
+	static void annotateBlob(Mat& rgbImage, const blob& blobInfo, int label) {
+		Scalar BLACK = Scalar(0, 0, 0);
+		Scalar RED = Scalar(0, 0, 255);
+		Rect box = blobInfo.boundingBox;
+
+		circle(rgbImage, blobInfo.cog, 1, BLACK, 2);
+		rectangle(rgbImage, box, RED, 1);
+		putText(
+			rgbImage,
+			to_string(label),
+			Point(box.x + box.width, box.y),
+			FONT_HERSHEY_PLAIN, 1.0, RED, 1);
+	}
 }
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -13,7 +13,9 @@
 #define IP_BINARY_REGIONS_H
 
 /* Include files */
+#include <vector>
 #include <opencv2/opencv.hpp>
+#include "RegionMoments.h"
 
 /* Namespaces */
 using namespace cv;
@@ -25,16 +27,21 @@ namespace ip
 		unsigned size = 0;			// Number pixels
 		Point cog;					// Center of gravity
 		Rect2i boundingBox;
+		RegionMoments moments;		// Raw moments up to third order
 	} blob;
 
 	/* Region labeling */
 	void labelRegions(Mat& binImage);
-	void floodFill(Mat& binImage, int x, int y, uchar label);
+	int labelRegions(const Mat& binImage, Mat& labelImage, int connectivity = 8);
+	int labelRegionsParallel(const Mat& binImage, Mat& labelImage, int connectivity = 8);
+	unsigned floodFill(Mat& binImage, int x, int y, uchar label, int connectivity = 4, Rect2i* boundingBox = NULL);
 
 	/* BLOB processing */
 	void labels2RGB(const Mat& labelImage, Mat& rgbImage);
 	void labels2BlobFeatures(const Mat& labelImage, blob blobs[256]);
+	void analyzeBlobs(const Mat& binImage, std::vector<blob>& blobs, int connectivity = 8);
 	void annotateBlobs(Mat& rgbImage, const blob blobs[256]);
+	void annotateBlobs(Mat& rgbImage, const std::vector<blob>& blobs);
 }
 
 #endif /* IP_BINARY_REGIONS_H */
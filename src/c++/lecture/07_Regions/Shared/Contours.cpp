@@ -0,0 +1,311 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "Contours.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Freeman chain code directions (0: east, counterclockwise to 7: south-east; y-axis pointing down) */
+	static const int DX[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+	static const int DY[8] = { 0, -1, -1, -1, 0, 1, 1, 1 };
+
+	/* Prototypes (module internal) */
+	static void copyWithBorder(const Mat& image, vector<int>& pixels, int& maxValue);
+	static void followBorder(vector<int>& pixels, int stride, int start, int backgroundDir, int regionLabel, contour& border, vector<uchar>& chainCodes);
+
+	/*****************************************************************************************************
+	 * Contour tracing
+	 *****************************************************************************************************/
+
+	/*! Trace outer and hole borders of all regions in a binary image (Suzuki/Abe).
+	*
+	* Reference: S. Suzuki, K. Abe: Topological structural analysis of digitized binary images by
+	* border following, Computer Vision, Graphics, and Image Processing 30(1), 1985, pp. 32-46.
+	*
+	* Regions are 8-connected, holes are 4-connected. A raster scan starts an outer border at region
+	* pixels with a background pixel on the left and a hole border at region pixels with a background
+	* pixel on the right. Followed borders are marked in a working copy, so that each border is
+	* followed once. The contour pixels are the same as for cv::findContours() with RETR_LIST and
+	* CHAIN_APPROX_NONE.
+	*
+	* Chain codes of all contours are stored in one array. Area, perimeter, and circularity are
+	* calculated while following the borders.
+	*
+	* \param binImage [in] Binary image (type CV_8U, regions are pixels with values not 0)
+	* \param contours [out] Contours in the order of their start pixels (raster order)
+	* \param chainCodes [out] Freeman chain codes of all contours
+	* \return Number of contours
+	*/
+	int traceContours(const Mat& binImage, vector<contour>& contours, vector<uchar>& chainCodes) {
+		contours.clear();
+		chainCodes.clear();
+
+		// Check image type
+		if (binImage.type() != CV_8U)
+			return 0;
+
+		// Working copy with values in {0, 1} and a border of zeros
+		vector<int> pixels;
+		int maxValue;
+		copyWithBorder(binImage, pixels, maxValue);
+
+		int stride = binImage.cols + 2;
+		int borderNumber = 1;		// Border number 1 is the image frame
+
+		// Raster scan for unfollowed borders
+		for (int y = 0; y < binImage.rows; y++) {
+			for (int x = 0; x < binImage.cols; x++) {
+				int i = (y + 1) * stride + x + 1;
+				if (pixels[i] == 0)
+					continue;
+
+				// Outer border (background on the left) or hole border (background on the right)?
+				int backgroundDir = -1;
+				if ((pixels[i] == 1) && (pixels[i - 1] == 0))
+					backgroundDir = 4;
+				else if ((pixels[i] >= 1) && (pixels[i + 1] == 0))
+					backgroundDir = 0;
+
+				if (backgroundDir < 0)
+					continue;
+
+				// Follow border
+				contour border;
+				border.start = Point(x, y);
+				border.label = ++borderNumber;
+				border.isHole = (backgroundDir == 0);
+				followBorder(pixels, stride, i, backgroundDir, 0, border, chainCodes);
+				contours.push_back(border);
+			}
+		}
+
+		return (int)contours.size();
+	}
+
+	/*! Trace outer borders of all regions in a label image in one raster scan.
+	*
+	* The first pixel of each label in raster order has no region pixel on its left and starts the
+	* outer border of the region. Each region is traced once with 8-neighborhood, regardless of the
+	* connectivity used for labeling. Contours have the same pixels as the outer borders found by
+	* traceContours() for the binary image.
+	*
+	* \param labelImage [in] Labels of regions and 0 for background (type CV_32S, e.g., by labelRegions())
+	* \param contours [out] Contours in the order of their start pixels (raster order)
+	* \param chainCodes [out] Freeman chain codes of all contours
+	* \return Number of contours
+	*/
+	int traceLabelContours(const Mat& labelImage, vector<contour>& contours, vector<uchar>& chainCodes) {
+		contours.clear();
+		chainCodes.clear();
+
+		// Check image type
+		if (labelImage.type() != CV_32S)
+			return 0;
+
+		// Working copy with a border of zeros
+		vector<int> pixels;
+		int maxLabel;
+		copyWithBorder(labelImage, pixels, maxLabel);
+
+		int stride = labelImage.cols + 2;
+		vector<bool> isTraced(std::max(maxLabel, 0) + 1, false);
+
+		// Raster scan for first pixels of labels
+		for (int y = 0; y < labelImage.rows; y++) {
+			for (int x = 0; x < labelImage.cols; x++) {
+				int i = (y + 1) * stride + x + 1;
+				int label = pixels[i];
+				if ((label <= 0) || isTraced[label])
+					continue;
+
+				contour border;
+				border.start = Point(x, y);
+				border.label = label;
+				followBorder(pixels, stride, i, 4, label, border, chainCodes);
+				contours.push_back(border);
+				isTraced[label] = true;
+			}
+		}
+
+		return (int)contours.size();
+	}
+
+	/*! Copy image to integer array with a border of zeros.
+	*
+	* 8-bit images are copied with values in {0, 1}, 32-bit images with their values.
+	*
+	* \param image [in] Image (type CV_8U or CV_32S)
+	* \param pixels [out] Copied pixel values ((rows + 2) * (cols + 2) elements)
+	* \param maxValue [out] Maximum value
+	*/
+	static void copyWithBorder(const Mat& image, vector<int>& pixels, int& maxValue) {
+		int stride = image.cols + 2;
+		pixels.assign((size_t)(image.rows + 2) * stride, 0);
+		maxValue = 0;
+
+		for (int y = 0; y < image.rows; y++) {
+			int* dstRow = &pixels[(size_t)(y + 1) * stride + 1];
+
+			if (image.type() == CV_32S) {
+				const int* srcRow = image.ptr<int>(y);
+				for (int x = 0; x < image.cols; x++) {
+					dstRow[x] = srcRow[x];
+					maxValue = std::max(maxValue, srcRow[x]);
+				}
+			}
+			else {
+				const uchar* srcRow = image.ptr<uchar>(y);
+				for (int x = 0; x < image.cols; x++)
+					dstRow[x] = (srcRow[x] != 0) ? 1 : 0;
+				maxValue = 1;
+			}
+		}
+	}
+
+	/*! Follow a border and append its chain codes (Moore neighborhood, Suzuki/Abe).
+	*
+	* The neighbors of the current pixel are searched counterclockwise, starting after the previous
+	* pixel. Following stops when the second pixel is to be entered again from the start pixel. For
+	* binary images (region label 0), followed pixels are marked by the border number (negative, if
+	* the east neighbor is background).
+	*
+	* The corrected perimeter is 0.980 * n_even + 1.406 * n_odd - 0.091 * n_corners with the numbers
+	* of even and odd chain codes and of changes between successive chain codes (Vossepoel/Smeulders).
+	*
+	* \param pixels [in/out] Image with a border of zeros
+	* \param stride [in] Number of elements per row
+	* \param start [in] Index of start pixel
+	* \param backgroundDir [in] Direction of a background neighbor of the start pixel
+	* \param regionLabel [in] Region pixels have this value (or any value other than 0 for label 0)
+	* \param border [in/out] Contour (start and label set, code range and measures calculated)
+	* \param chainCodes [in/out] Array to append chain codes to
+	*/
+	static void followBorder(vector<int>& pixels, int stride, int start, int backgroundDir, int regionLabel, contour& border, vector<uchar>& chainCodes) {
+		int offsets[8];
+		for (int k = 0; k < 8; k++)
+			offsets[k] = DX[k] + DY[k] * stride;
+
+		bool isMarking = (regionLabel == 0);
+		auto isRegion = [&](int i) { return isMarking ? (pixels[i] != 0) : (pixels[i] == regionLabel); };
+
+		border.firstCode = (int)chainCodes.size();
+		border.numberCodes = 0;
+
+		// Search clockwise from background neighbor for a region pixel
+		int firstDir = -1;
+		for (int k = 0; k < 8; k++) {
+			int dir = (backgroundDir - k + 8) % 8;
+			if (isRegion(start + offsets[dir])) {
+				firstDir = dir;
+				break;
+			}
+		}
+
+		// Single pixel
+		if (firstDir < 0) {
+			if (isMarking)
+				pixels[start] = -border.label;
+			return;
+		}
+
+		// Follow border
+		int second = start + offsets[firstDir];
+		int current = start, previousDir = firstDir;
+		int x = border.start.x, y = border.start.y;
+		int64_t doubleArea = 0;
+		int numberEven = 0, numberOdd = 0, numberCorners = 0;
+
+		while (true) {
+			// Search counterclockwise, starting after previous pixel
+			bool isEastBackground = false;
+			int dir = previousDir, next = current;
+
+			for (int k = 1; k <= 8; k++) {
+				dir = (previousDir + k) % 8;
+				next = current + offsets[dir];
+				if (isRegion(next))
+					break;
+				if (dir == 0)
+					isEastBackground = true;
+			}
+
+			// Mark followed pixel
+			if (isMarking) {
+				if (isEastBackground)
+					pixels[current] = -border.label;
+				else if (pixels[current] == 1)
+					pixels[current] = border.label;
+			}
+
+			// Append chain code and update measures (shoelace formula for area)
+			if ((border.numberCodes > 0) && (dir != chainCodes.back()))
+				numberCorners++;
+			chainCodes.push_back((uchar)dir);
+			border.numberCodes++;
+
+			doubleArea += (int64_t)x * DY[dir] - (int64_t)DX[dir] * y;
+			x += DX[dir];
+			y += DY[dir];
+			if (dir % 2 == 0)
+				numberEven++;
+			else
+				numberOdd++;
+
+			// Back at start and about to enter the second pixel again?
+			if ((next == start) && (current == second))
+				break;
+
+			previousDir = (dir + 4) % 8;
+			current = next;
+		}
+
+		// Corner between last and first chain code
+		if (chainCodes.back() != chainCodes[border.firstCode])
+			numberCorners++;
+
+		// Measures
+		border.area = 0.5 * std::abs((double)doubleArea);
+		border.perimeter = 0.980 * numberEven + 1.406 * numberOdd - 0.091 * numberCorners;
+		border.circularity = (border.perimeter > 0.0) ? 4.0 * CV_PI * border.area / (border.perimeter * border.perimeter) : 0.0;
+	}
+
+	/*****************************************************************************************************
+	 * Chain codes
+	 *****************************************************************************************************/
+
+	/*! Convert chain codes of a contour to pixel locations.
+	*
+	* \param border [in] Contour
+	* \param chainCodes [in] Freeman chain codes of all contours
+	* \param points [out] Contour pixels, starting with the start pixel (each pixel once per visit)
+	*/
+	void chainCodes2Points(const contour& border, const vector<uchar>& chainCodes, vector<Point>& points) {
+		Point point = border.start;
+
+		points.clear();
+		points.reserve(std::max(border.numberCodes, 1));
+		points.push_back(point);
+
+		for (int i = 0; i < border.numberCodes - 1; i++) {
+			uchar code = chainCodes[border.firstCode + i];
+			point += Point(DX[code], DY[code]);
+			points.push_back(point);
+		}
+	}
+}
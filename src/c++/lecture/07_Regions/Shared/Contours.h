@@ -0,0 +1,41 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_CONTOURS_H
+#define IP_CONTOURS_H
+
+/* Include files */
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Contour data type (chain codes are stored in a common array) */
+	typedef struct contour {
+		cv::Point start;				// First contour pixel
+		int firstCode = 0;				// Index of first chain code in array of chain codes
+		int numberCodes = 0;			// Number of chain codes (0 for single pixels)
+		int label = 0;					// Region label (label image) or border number (binary image)
+		bool isHole = false;			// Border of a hole (binary image only)
+		double area = 0.0;				// Area enclosed by polygon through pixel centers
+		double perimeter = 0.0;			// Corrected chain-code perimeter
+		double circularity = 0.0;		// 4 * pi * area / perimeter^2
+	} contour;
+
+	/* Contour tracing */
+	int traceContours(const cv::Mat& binImage, std::vector<contour>& contours, std::vector<uchar>& chainCodes);
+	int traceLabelContours(const cv::Mat& labelImage, std::vector<contour>& contours, std::vector<uchar>& chainCodes);
+
+	/* Chain codes */
+	void chainCodes2Points(const contour& border, const std::vector<uchar>& chainCodes, std::vector<cv::Point>& points);
+}
+
+#endif /* IP_CONTOURS_H */
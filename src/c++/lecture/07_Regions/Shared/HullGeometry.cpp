@@ -0,0 +1,266 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "HullGeometry.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static int64_t cross(const Point& o, const Point& a, const Point& b);
+	static void rotatingCalipers(const vector<Point>& hull, hullMeasures& measures);
+
+	/*****************************************************************************************************
+	 * Convex hull
+	 *****************************************************************************************************/
+
+	/*! Convex hull of a contour by Andrew's monotone chain algorithm.
+	*
+	* Vertices of the hull are leftmost or rightmost contour pixels of their rows. These row extremes
+	* are collected from the chain codes in sorted order (by y, then x), so that the monotone chain
+	* needs no sorting and runs in linear time. Collinear points are removed.
+	*
+	* \param border [in] Contour
+	* \param chainCodes [in] Freeman chain codes of all contours
+	* \param hull [out] Hull vertices (counterclockwise for y-axis pointing up), may be workspace.hull
+	* \param workspace [in] Working memory (allocations are reused)
+	*/
+	void chainCodes2Hull(const contour& border, const vector<uchar>& chainCodes, vector<Point>& hull, hullWorkspace& workspace) {
+		// Contour pixels and range of rows
+		vector<Point>& points = workspace.points;
+		chainCodes2Points(border, chainCodes, points);
+
+		int minY = border.start.y, maxY = border.start.y;
+		for (const Point& point : points) {
+			minY = std::min(minY, point.y);
+			maxY = std::max(maxY, point.y);
+		}
+
+		// Leftmost and rightmost pixel of each row
+		int numberRows = maxY - minY + 1;
+		workspace.rowMin.assign(numberRows, INT_MAX);
+		workspace.rowMax.assign(numberRows, INT_MIN);
+
+		for (const Point& point : points) {
+			int row = point.y - minY;
+			workspace.rowMin[row] = std::min(workspace.rowMin[row], point.x);
+			workspace.rowMax[row] = std::max(workspace.rowMax[row], point.x);
+		}
+
+		// Row extremes sorted by y, then x
+		points.clear();
+		for (int row = 0; row < numberRows; row++) {
+			points.push_back(Point(workspace.rowMin[row], minY + row));
+			if (workspace.rowMax[row] != workspace.rowMin[row])
+				points.push_back(Point(workspace.rowMax[row], minY + row));
+		}
+
+		// Monotone chain (first and second half of hull)
+		int n = (int)points.size(), k = 0;
+		hull.resize(2 * n);
+
+		for (int i = 0; i < n; i++) {
+			while ((k >= 2) && (cross(hull[k - 2], hull[k - 1], points[i]) <= 0))
+				k--;
+			hull[k++] = points[i];
+		}
+		for (int i = n - 2, t = k + 1; i >= 0; i--) {
+			while ((k >= t) && (cross(hull[k - 2], hull[k - 1], points[i]) <= 0))
+				k--;
+			hull[k++] = points[i];
+		}
+		hull.resize((n > 1) ? k - 1 : n);
+
+		// Counterclockwise orientation (positive signed area for y-axis pointing up)
+		int64_t doubleArea = 0;
+		for (size_t i = 0; i < hull.size(); i++) {
+			const Point& a = hull[i];
+			const Point& b = hull[(i + 1) % hull.size()];
+			doubleArea += (int64_t)a.x * b.y - (int64_t)b.x * a.y;
+		}
+		if (doubleArea < 0)
+			reverse(hull.begin(), hull.end());
+	}
+
+	/*! Cross product of vectors o->a and o->b (positive for a counterclockwise turn).
+	*
+	* \param o [in] Common origin
+	* \param a [in] End of first vector
+	* \param b [in] End of second vector
+	* \return Cross product
+	*/
+	static int64_t cross(const Point& o, const Point& a, const Point& b) {
+		return (int64_t)(a.x - o.x) * (b.y - o.y) - (int64_t)(a.y - o.y) * (b.x - o.x);
+	}
+
+	/*****************************************************************************************************
+	 * Hull geometry
+	 *****************************************************************************************************/
+
+	/*! Measures of a contour's convex hull.
+	*
+	* Calculates the convex hull, its area and perimeter, convexity and solidity, and the oriented
+	* measures by rotating calipers (see rotatingCalipers()). All measures refer to pixel centers.
+	* Costs are linear in the number of chain codes. No memory is allocated, once the workspace has
+	* grown to the size of the largest contour.
+	*
+	* \param border [in] Contour (e.g., by traceContours())
+	* \param chainCodes [in] Freeman chain codes of all contours
+	* \param measures [out] Hull measures
+	* \param workspace [in] Working memory (allocations are reused)
+	*/
+	void hullGeometry(const contour& border, const vector<uchar>& chainCodes, hullMeasures& measures, hullWorkspace& workspace) {
+		vector<Point>& hull = workspace.hull;
+		chainCodes2Hull(border, chainCodes, hull, workspace);
+		measures = hullMeasures();
+
+		// Area and perimeter
+		int64_t doubleArea = 0;
+		for (size_t i = 0; i < hull.size(); i++) {
+			const Point& a = hull[i];
+			const Point& b = hull[(i + 1) % hull.size()];
+			doubleArea += (int64_t)a.x * b.y - (int64_t)b.x * a.y;
+			measures.hullPerimeter += sqrt((double)(b.x - a.x) * (b.x - a.x) + (double)(b.y - a.y) * (b.y - a.y));
+		}
+		measures.hullArea = 0.5 * (double)doubleArea;
+
+		// Convexity and solidity (1 for degenerated hulls)
+		if (border.perimeter > 0.0)
+			measures.convexity = std::min(measures.hullPerimeter / border.perimeter, 1.0);
+		if (measures.hullArea > 0.0)
+			measures.solidity = std::min(border.area / measures.hullArea, 1.0);
+
+		// Oriented measures
+		rotatingCalipers(hull, measures);
+	}
+
+	/*! Measures of many contours' convex hulls (contours in parallel).
+	*
+	* \param contours [in] Contours (e.g., by traceContours())
+	* \param chainCodes [in] Freeman chain codes of all contours
+	* \param measures [out] Hull measures of each contour
+	*/
+	void hullGeometry(const vector<contour>& contours, const vector<uchar>& chainCodes, vector<hullMeasures>& measures) {
+		measures.resize(contours.size());
+
+		parallel_for_(Range(0, (int)contours.size()), [&](const Range& range) {
+			hullWorkspace workspace;
+
+			for (int i = range.start; i < range.end; i++)
+				hullGeometry(contours[i], chainCodes, measures[i], workspace);
+		});
+	}
+
+	/*! Oriented measures of a convex polygon by rotating calipers (Shamos, Toussaint).
+	*
+	* One caliper is placed on each hull edge in turn. The farthest vertex from the edge and the
+	* extreme vertices along the edge move forward monotonically, so that all edges are processed in
+	* linear time in total:
+	* - Minimum Feret diameter: Smallest distance of an edge to its farthest vertex.
+	* - Minimum-area rectangle: One side of the rectangle lies on a hull edge (Freeman/Shapira).
+	* - Maximum Feret diameter: Largest distance of antipodal vertices.
+	*
+	* \param hull [in] Convex polygon (counterclockwise for y-axis pointing up, no collinear vertices)
+	* \param measures [in/out] Measures to set
+	*/
+	static void rotatingCalipers(const vector<Point>& hull, hullMeasures& measures) {
+		int n = (int)hull.size();
+		if (n == 0)
+			return;
+
+		// Point or line segment
+		if (n <= 2) {
+			Point2d a(hull[0].x, hull[0].y), b(hull[n - 1].x, hull[n - 1].y);
+			Point2d d = b - a;
+			double length = sqrt(d.x * d.x + d.y * d.y);
+
+			measures.maxFeret = length;
+			measures.maxFeretAngle = atan2(d.y, d.x);
+			measures.minFeretAngle = measures.maxFeretAngle + 0.5 * CV_PI;
+			measures.minAreaRect = RotatedRect(Point2f((float)(0.5 * (a.x + b.x)), (float)(0.5 * (a.y + b.y))), Size2f((float)length, 0.0f), (float)(measures.maxFeretAngle * 180.0 / CV_PI));
+			return;
+		}
+
+		auto vertex = [&](int i) { return Point2d(hull[i % n].x, hull[i % n].y); };
+		const double EPS = 1e-9;
+		double minArea = -1.0, minWidth = -1.0, maxDistance2 = -1.0;
+		int far = 0, right = 0, left = 0;
+
+		for (int i = 0; i < n; i++) {
+			// Edge direction e and inner normal v
+			Point2d p = vertex(i);
+			Point2d e = vertex(i + 1) - p;
+			e *= 1.0 / sqrt(e.x * e.x + e.y * e.y);
+			Point2d v(-e.y, e.x);
+
+			// Farthest vertex from edge and extreme vertices along edge (full search for first edge only)
+			if (i == 0) {
+				for (int j = 1; j < n; j++) {
+					Point2d d = vertex(j) - p;
+					if (v.dot(d) > v.dot(vertex(far) - p))
+						far = j;
+					if (e.dot(d) > e.dot(vertex(right) - p))
+						right = j;
+					if (e.dot(d) < e.dot(vertex(left) - p))
+						left = j;
+				}
+			}
+			else {
+				while (v.dot(vertex(far + 1) - p) > v.dot(vertex(far) - p) + EPS)
+					far++;
+				while (e.dot(vertex(right + 1) - p) > e.dot(vertex(right) - p) + EPS)
+					right++;
+				while (e.dot(vertex(left + 1) - p) < e.dot(vertex(left) - p) - EPS)
+					left++;
+			}
+
+			// Minimum Feret diameter
+			double width = v.dot(vertex(far) - p);
+			if ((minWidth < 0.0) || (width < minWidth)) {
+				minWidth = width;
+				measures.minFeretAngle = atan2(v.y, v.x);
+			}
+
+			// Minimum-area rectangle
+			double minAlong = e.dot(vertex(left) - p), maxAlong = e.dot(vertex(right) - p);
+			double area = (maxAlong - minAlong) * width;
+			if ((minArea < 0.0) || (area < minArea)) {
+				minArea = area;
+				Point2d center = p + e * (0.5 * (minAlong + maxAlong)) + v * (0.5 * width);
+				measures.minAreaRect = RotatedRect(Point2f((float)center.x, (float)center.y), Size2f((float)(maxAlong - minAlong), (float)width), (float)(atan2(e.y, e.x) * 180.0 / CV_PI));
+			}
+
+			// Maximum Feret diameter (antipodal pairs of edge vertices and farthest vertices)
+			for (int a = i; a <= i + 1; a++) {
+				for (int b = far; b <= far + 1; b++) {
+					Point2d d = vertex(b) - vertex(a);
+					double distance2 = d.x * d.x + d.y * d.y;
+					if (distance2 > maxDistance2) {
+						maxDistance2 = distance2;
+						measures.maxFeretAngle = atan2(d.y, d.x);
+					}
+				}
+			}
+		}
+
+		measures.minFeret = minWidth;
+		measures.maxFeret = sqrt(maxDistance2);
+	}
+}
@@ -0,0 +1,48 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_HULL_GEOMETRY_H
+#define IP_HULL_GEOMETRY_H
+
+/* Include files */
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "Contours.h"
+
+namespace ip
+{
+	/* Measures of a region's convex hull (based on pixel centers) */
+	typedef struct hullMeasures {
+		cv::RotatedRect minAreaRect;	// Enclosing rectangle of minimum area (angle in degrees)
+		double minFeret = 0.0;			// Minimum caliper width
+		double maxFeret = 0.0;			// Maximum caliper width (diameter)
+		double minFeretAngle = 0.0;		// Direction of minimum caliper width in radians
+		double maxFeretAngle = 0.0;		// Direction of maximum caliper width in radians
+		double hullArea = 0.0;
+		double hullPerimeter = 0.0;
+		double convexity = 1.0;			// Hull perimeter / contour perimeter (at most 1)
+		double solidity = 1.0;			// Contour area / hull area (at most 1)
+	} hullMeasures;
+
+	/* Working memory reused for many contours */
+	typedef struct hullWorkspace {
+		std::vector<int> rowMin, rowMax;	// Leftmost and rightmost contour pixel of each row
+		std::vector<cv::Point> points;		// Row extremes sorted by y and x
+		std::vector<cv::Point> hull;		// Convex hull (counterclockwise for y-axis pointing up)
+	} hullWorkspace;
+
+	/* Prototypes */
+	void chainCodes2Hull(const contour& border, const std::vector<uchar>& chainCodes, std::vector<cv::Point>& hull, hullWorkspace& workspace);
+	void hullGeometry(const contour& border, const std::vector<uchar>& chainCodes, hullMeasures& measures, hullWorkspace& workspace);
+	void hullGeometry(const std::vector<contour>& contours, const std::vector<uchar>& chainCodes, std::vector<hullMeasures>& measures);
+}
+
+#endif /* IP_HULL_GEOMETRY_H */
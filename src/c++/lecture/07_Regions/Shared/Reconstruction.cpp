@@ -0,0 +1,325 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <queue>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "Reconstruction.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Prototypes (module internal) */
+	static void labelComponents(const Mat& binImage, bool isForeground, int connectivity, vector<int>& roots);
+	static int findRoot(vector<int>& parents, int index);
+
+	/*****************************************************************************************************
+	 * Morphological reconstruction
+	 *****************************************************************************************************/
+
+	/*! Morphological reconstruction by dilation (hybrid algorithm by Vincent).
+	*
+	* Reference: L. Vincent: Morphological grayscale reconstruction in image analysis: Applications
+	* and efficient algorithms, IEEE Transactions on Image Processing 2(2), 1993, pp. 176-201.
+	*
+	* The marker is dilated repeatedly, but never beyond the mask, until it does not change anymore.
+	* Instead of repeated dilations, the algorithm needs three passes:
+	* 1. Raster scan: Propagate values from the upper and left neighbors.
+	* 2. Anti-raster scan: Propagate values from the lower and right neighbors. Pixels that can still
+	*    propagate their values to a neighbor are added to a FIFO queue.
+	* 3. Queue: Propagate values from the queued pixels until the queue is empty.
+	* Applied to binary images, the result contains all regions of the mask that contain a marker pixel.
+	*
+	* \param marker [in] Marker image (type CV_8U, values above the mask are reduced to the mask)
+	* \param mask [in] Mask image (type CV_8U, same size as marker)
+	* \param reconstructed [out] Reconstructed image (type CV_8U)
+	* \param connectivity [in] Neighborhood (4 or 8)
+	*/
+	void reconstructByDilation(const Mat& marker, const Mat& mask, Mat& reconstructed, int connectivity) {
+		// Check parameters
+		if ((marker.type() != CV_8U) || (mask.type() != CV_8U) || (marker.size() != mask.size()))
+			return;
+		if ((connectivity != 4) && (connectivity != 8))
+			return;
+
+		// Copy images with a border of zeros (border pixels do not propagate and are never queued)
+		int rows = marker.rows, cols = marker.cols;
+		int stride = cols + 2;
+		vector<uchar> J((size_t)(rows + 2) * stride, 0), I((size_t)(rows + 2) * stride, 0);
+
+		for (int y = 0; y < rows; y++) {
+			const uchar* markerRow = marker.ptr<uchar>(y);
+			const uchar* maskRow = mask.ptr<uchar>(y);
+			uchar* JRow = &J[(size_t)(y + 1) * stride + 1];
+			uchar* IRow = &I[(size_t)(y + 1) * stride + 1];
+
+			for (int x = 0; x < cols; x++) {
+				IRow[x] = maskRow[x];
+				JRow[x] = std::min(markerRow[x], maskRow[x]);
+			}
+		}
+
+		// Offsets of neighbors scanned before (N+) and after (N-) a pixel in raster order
+		int upper[4] = { -1, -stride, -stride - 1, -stride + 1 };
+		int lower[4] = { 1, stride, stride + 1, stride - 1 };
+		int numberHalf = connectivity / 2;
+
+		// 1. Raster scan
+		for (int y = 1; y <= rows; y++) {
+			for (int i = y * stride + 1; i <= y * stride + cols; i++) {
+				uchar value = J[i];
+				for (int k = 0; k < numberHalf; k++)
+					value = std::max(value, J[i + upper[k]]);
+				J[i] = std::min(value, I[i]);
+			}
+		}
+
+		// 2. Anti-raster scan (queue pixels able to propagate)
+		queue<int> fifo;
+
+		for (int y = rows; y >= 1; y--) {
+			for (int i = y * stride + cols; i >= y * stride + 1; i--) {
+				uchar value = J[i];
+				for (int k = 0; k < numberHalf; k++)
+					value = std::max(value, J[i + lower[k]]);
+				J[i] = std::min(value, I[i]);
+
+				for (int k = 0; k < numberHalf; k++) {
+					int q = i + lower[k];
+					if ((J[q] < J[i]) && (J[q] < I[q])) {
+						fifo.push(i);
+						break;
+					}
+				}
+			}
+		}
+
+		// 3. Propagation by queue
+		while (!fifo.empty()) {
+			int p = fifo.front();
+			fifo.pop();
+
+			for (int k = 0; k < connectivity; k++) {
+				int q = p + ((k < numberHalf) ? upper[k] : lower[k - numberHalf]);
+				if ((J[q] < J[p]) && (I[q] != J[q])) {
+					J[q] = std::min(J[p], I[q]);
+					fifo.push(q);
+				}
+			}
+		}
+
+		// Copy result
+		reconstructed.create(rows, cols, CV_8U);
+		for (int y = 0; y < rows; y++) {
+			const uchar* JRow = &J[(size_t)(y + 1) * stride + 1];
+			std::copy(JRow, JRow + cols, reconstructed.ptr<uchar>(y));
+		}
+	}
+
+	/*****************************************************************************************************
+	 * Connected components (union-find)
+	 *****************************************************************************************************/
+
+	/*! Label connected components by union-find on pixel indices.
+	*
+	* Each pixel is linked to its already scanned neighbors of the same set. Roots are always linked
+	* to the smaller index, so that the parent of a pixel precedes it in raster order. A final raster
+	* scan then resolves all roots in linear time. The root of a component is its first pixel.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param isForeground [in] Label pixels with values not 0 on true and with value 0 on false
+	* \param connectivity [in] Neighborhood (4 or 8)
+	* \param roots [out] Index of the component's root for each pixel (-1 for pixels not labeled)
+	*/
+	static void labelComponents(const Mat& binImage, bool isForeground, int connectivity, vector<int>& roots) {
+		int rows = binImage.rows, cols = binImage.cols;
+		roots.assign((size_t)rows * cols, -1);
+
+		// Link pixels to scanned neighbors (left, upper, upper left, upper right)
+		for (int y = 0; y < rows; y++) {
+			const uchar* row = binImage.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++) {
+				if ((row[x] != 0) != isForeground)
+					continue;
+
+				int index = y * cols + x;
+				roots[index] = index;
+
+				int neighbors[4] = { -1, -1, -1, -1 };
+				if (x > 0)
+					neighbors[0] = index - 1;
+				if (y > 0) {
+					neighbors[1] = index - cols;
+					if (connectivity == 8) {
+						if (x > 0)
+							neighbors[2] = index - cols - 1;
+						if (x < cols - 1)
+							neighbors[3] = index - cols + 1;
+					}
+				}
+
+				for (int neighbor : neighbors) {
+					if ((neighbor < 0) || (roots[neighbor] < 0))
+						continue;
+
+					int rootA = findRoot(roots, index);
+					int rootB = findRoot(roots, neighbor);
+					if (rootA < rootB)
+						roots[rootB] = rootA;
+					else if (rootB < rootA)
+						roots[rootA] = rootB;
+				}
+			}
+		}
+
+		// Resolve roots (parents precede their children)
+		for (int index = 0; index < (int)roots.size(); index++) {
+			if (roots[index] >= 0)
+				roots[index] = roots[roots[index]];
+		}
+	}
+
+	/*! Find root of a union-find tree (with path halving).
+	*
+	* \param parents [in/out] Parent index of each element
+	* \param index [in] Element to find root of
+	* \return Index of root
+	*/
+	static int findRoot(vector<int>& parents, int index) {
+		while (parents[index] != index) {
+			parents[index] = parents[parents[index]];
+			index = parents[index];
+		}
+		return index;
+	}
+
+	/*****************************************************************************************************
+	 * Region filters
+	 *****************************************************************************************************/
+
+	/*! Fill holes in binary regions.
+	*
+	* Holes are background components not connected to the image border. Background components are
+	* connected by the complementary neighborhood (4 for 8-connected foreground and vice versa).
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param filled [out] Binary image with filled holes and values in {0, 255}
+	* \param connectivity [in] Neighborhood of the foreground (4 or 8)
+	*/
+	void fillHoles(const Mat& binImage, Mat& filled, int connectivity) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return;
+
+		// Background components and whether they touch the image border
+		int rows = binImage.rows, cols = binImage.cols;
+		vector<int> roots;
+		labelComponents(binImage, false, 12 - connectivity, roots);
+
+		vector<bool> isBorder(roots.size(), false);
+		for (int y = 0; y < rows; y++) {
+			int step = ((y == 0) || (y == rows - 1)) ? 1 : std::max(cols - 1, 1);
+			for (int x = 0; x < cols; x += step) {
+				int root = roots[y * cols + x];
+				if (root >= 0)
+					isBorder[root] = true;
+			}
+		}
+
+		// Set pixels of holes
+		filled.create(rows, cols, CV_8U);
+		for (int y = 0; y < rows; y++) {
+			const int* rootRow = &roots[(size_t)y * cols];
+			uchar* dstRow = filled.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++)
+				dstRow[x] = ((rootRow[x] < 0) || !isBorder[rootRow[x]]) ? 255 : 0;
+		}
+	}
+
+	/*! Remove binary regions connected to the image border.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param cleared [out] Binary image without border regions and values in {0, 255}
+	* \param connectivity [in] Neighborhood (4 or 8)
+	*/
+	void clearBorderObjects(const Mat& binImage, Mat& cleared, int connectivity) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return;
+
+		// Regions and whether they touch the image border
+		int rows = binImage.rows, cols = binImage.cols;
+		vector<int> roots;
+		labelComponents(binImage, true, connectivity, roots);
+
+		vector<bool> isBorder(roots.size(), false);
+		for (int y = 0; y < rows; y++) {
+			int step = ((y == 0) || (y == rows - 1)) ? 1 : std::max(cols - 1, 1);
+			for (int x = 0; x < cols; x += step) {
+				int root = roots[y * cols + x];
+				if (root >= 0)
+					isBorder[root] = true;
+			}
+		}
+
+		// Keep pixels of inner regions
+		cleared.create(rows, cols, CV_8U);
+		for (int y = 0; y < rows; y++) {
+			const int* rootRow = &roots[(size_t)y * cols];
+			uchar* dstRow = cleared.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++)
+				dstRow[x] = ((rootRow[x] >= 0) && !isBorder[rootRow[x]]) ? 255 : 0;
+		}
+	}
+
+	/*! Area opening: Remove binary regions with less pixels than a minimum area.
+	*
+	* Other than a morphological opening, the shape of the remaining regions is not changed.
+	*
+	* \param binImage [in] Binary image (type CV_8U)
+	* \param opened [out] Binary image without small regions and values in {0, 255}
+	* \param minArea [in] Minimum number of pixels of remaining regions
+	* \param connectivity [in] Neighborhood (4 or 8)
+	*/
+	void areaOpening(const Mat& binImage, Mat& opened, int minArea, int connectivity) {
+		// Check parameters
+		if ((binImage.type() != CV_8U) || ((connectivity != 4) && (connectivity != 8)))
+			return;
+
+		// Regions and their areas
+		int rows = binImage.rows, cols = binImage.cols;
+		vector<int> roots;
+		labelComponents(binImage, true, connectivity, roots);
+
+		vector<int> areas(roots.size(), 0);
+		for (int root : roots) {
+			if (root >= 0)
+				areas[root]++;
+		}
+
+		// Keep pixels of large regions
+		opened.create(rows, cols, CV_8U);
+		for (int y = 0; y < rows; y++) {
+			const int* rootRow = &roots[(size_t)y * cols];
+			uchar* dstRow = opened.ptr<uchar>(y);
+
+			for (int x = 0; x < cols; x++)
+				dstRow[x] = ((rootRow[x] >= 0) && (areas[rootRow[x]] >= minArea)) ? 255 : 0;
+		}
+	}
+}
@@ -0,0 +1,29 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_RECONSTRUCTION_H
+#define IP_RECONSTRUCTION_H
+
+/* Include files */
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Morphological reconstruction */
+	void reconstructByDilation(const cv::Mat& marker, const cv::Mat& mask, cv::Mat& reconstructed, int connectivity = 8);
+
+	/* Region filters */
+	void fillHoles(const cv::Mat& binImage, cv::Mat& filled, int connectivity = 8);
+	void clearBorderObjects(const cv::Mat& binImage, cv::Mat& cleared, int connectivity = 8);
+	void areaOpening(const cv::Mat& binImage, cv::Mat& opened, int minArea, int connectivity = 8);
+}
+
+#endif /* IP_RECONSTRUCTION_H */
@@ -0,0 +1,253 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <cmath>
+#include <opencv2/opencv.hpp>
+#include "RegionMoments.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/*****************************************************************************************************
+	 * Constructor and accumulation
+	 *****************************************************************************************************/
+
+	/*! Constructor (empty region).
+	*/
+	RegionMoments::RegionMoments(void) {
+		clear();
+	}
+
+	/*! Reset to empty region.
+	*/
+	void RegionMoments::clear(void) {
+		m00 = m10 = m01 = m20 = m11 = m02 = m30 = m21 = m12 = m03 = 0;
+	}
+
+	/*! Add single pixel to region.
+	*
+	* \param x [in] Location (x,y) of pixel
+	* \param y [in] Location (x,y) of pixel
+	*/
+	void RegionMoments::addPixel(int x, int y) {
+		int64_t x1 = x, y1 = y;
+		int64_t x2 = x1 * x1, y2 = y1 * y1;
+
+		m00++;
+		m10 += x1;
+		m01 += y1;
+		m20 += x2;
+		m11 += x1 * y1;
+		m02 += y2;
+		m30 += x2 * x1;
+		m21 += x2 * y1;
+		m12 += x1 * y2;
+		m03 += y2 * y1;
+	}
+
+	/*! Add horizontal run of pixels x0 <= x <= x1 in row y to region.
+	*
+	* The sums of x, x^2, and x^3 over the run are calculated in closed form by the differences of
+	* the sums from 0 to x1 and from 0 to x0 - 1.
+	*
+	* \param x0 [in] First column of run
+	* \param x1 [in] Last column of run
+	* \param y [in] Row of run
+	*/
+	void RegionMoments::addRun(int x0, int x1, int y) {
+		int64_t a = (int64_t)x0 - 1, b = x1, y1 = y;
+		int64_t n = b - a;
+		int64_t sumX = (b * (b + 1) - a * (a + 1)) / 2;
+		int64_t sumXX = (b * (b + 1) * (2 * b + 1) - a * (a + 1) * (2 * a + 1)) / 6;
+		int64_t sumXXX = (b * (b + 1) / 2) * (b * (b + 1) / 2) - (a * (a + 1) / 2) * (a * (a + 1) / 2);
+
+		m00 += n;
+		m10 += sumX;
+		m01 += n * y1;
+		m20 += sumXX;
+		m11 += sumX * y1;
+		m02 += n * y1 * y1;
+		m30 += sumXXX;
+		m21 += sumXX * y1;
+		m12 += sumX * y1 * y1;
+		m03 += n * y1 * y1 * y1;
+	}
+
+	/*! Add moments of another region (e.g., when regions are merged).
+	*
+	* \param moments [in] Moments of region to add
+	*/
+	void RegionMoments::add(const RegionMoments& moments) {
+		m00 += moments.m00;
+		m10 += moments.m10;
+		m01 += moments.m01;
+		m20 += moments.m20;
+		m11 += moments.m11;
+		m02 += moments.m02;
+		m30 += moments.m30;
+		m21 += moments.m21;
+		m12 += moments.m12;
+		m03 += moments.m03;
+	}
+
+	/*****************************************************************************************************
+	 * Moments
+	 *****************************************************************************************************/
+
+	/*! Get raw moment m_pq (sum of x^p * y^q).
+	*
+	* \param p [in] Order in x
+	* \param q [in] Order in y
+	* \return Raw moment (0 for p + q > 3)
+	*/
+	int64_t RegionMoments::getRaw(int p, int q) const {
+		switch (10 * p + q) {
+		case 0: return m00;
+		case 10: return m10;
+		case 1: return m01;
+		case 20: return m20;
+		case 11: return m11;
+		case 2: return m02;
+		case 30: return m30;
+		case 21: return m21;
+		case 12: return m12;
+		case 3: return m03;
+		default: return 0;
+		}
+	}
+
+	/*! Get central moment mu_pq (moment relative to the centroid).
+	*
+	* \param p [in] Order in x
+	* \param q [in] Order in y
+	* \return Central moment (0 for p + q > 3 or empty region)
+	*/
+	double RegionMoments::getCentral(int p, int q) const {
+		if (m00 == 0)
+			return 0.0;
+
+		double xc = (double)m10 / m00, yc = (double)m01 / m00;
+
+		switch (10 * p + q) {
+		case 0: return (double)m00;
+		case 20: return m20 - xc * m10;
+		case 11: return m11 - xc * m01;
+		case 2: return m02 - yc * m01;
+		case 30: return m30 - 3.0 * xc * m20 + 2.0 * xc * xc * m10;
+		case 21: return m21 - 2.0 * xc * m11 - yc * m20 + 2.0 * xc * xc * m01;
+		case 12: return m12 - 2.0 * yc * m11 - xc * m02 + 2.0 * yc * yc * m10;
+		case 3: return m03 - 3.0 * yc * m02 + 2.0 * yc * yc * m01;
+		default: return 0.0;		// Including first order (always 0)
+		}
+	}
+
+	/*! Get normalized central moment eta_pq = mu_pq / mu_00^(1 + (p + q) / 2).
+	*
+	* Normalized central moments are invariant to translation and scaling.
+	*
+	* \param p [in] Order in x
+	* \param q [in] Order in y
+	* \return Normalized central moment (0 for p + q > 3 or empty region)
+	*/
+	double RegionMoments::getNormalized(int p, int q) const {
+		if (m00 == 0)
+			return 0.0;
+
+		return getCentral(p, q) / pow((double)m00, 1.0 + 0.5 * (p + q));
+	}
+
+	/*! Get centroid (center of gravity).
+	*
+	* \return Centroid (0,0 for empty region)
+	*/
+	Point2d RegionMoments::getCentroid(void) const {
+		if (m00 == 0)
+			return Point2d(0.0, 0.0);
+
+		return Point2d((double)m10 / m00, (double)m01 / m00);
+	}
+
+	/*****************************************************************************************************
+	 * Shape descriptors
+	 *****************************************************************************************************/
+
+	/*! Get orientation of the major axis.
+	*
+	* \return Angle between major axis and x-axis in radians in [-pi/2, pi/2] (y-axis pointing down)
+	*/
+	double RegionMoments::getOrientation(void) const {
+		return 0.5 * atan2(2.0 * getCentral(1, 1), getCentral(2, 0) - getCentral(0, 2));
+	}
+
+	/*! Get axis lengths of the ellipse having the same second-order moments as the region.
+	*
+	* The lengths are 4 * sqrt(lambda) with the eigenvalues lambda of the covariance matrix.
+	*
+	* \param majorAxis [out] Length of major axis in pixels
+	* \param minorAxis [out] Length of minor axis in pixels
+	*/
+	void RegionMoments::getAxes(double& majorAxis, double& minorAxis) const {
+		majorAxis = minorAxis = 0.0;
+		if (m00 == 0)
+			return;
+
+		double a = getCentral(2, 0) / m00, b = getCentral(1, 1) / m00, c = getCentral(0, 2) / m00;
+		double root = sqrt(0.25 * (a - c) * (a - c) + b * b);
+		double lambda1 = 0.5 * (a + c) + root;
+		double lambda2 = 0.5 * (a + c) - root;
+
+		majorAxis = 4.0 * sqrt(std::max(lambda1, 0.0));
+		minorAxis = 4.0 * sqrt(std::max(lambda2, 0.0));
+	}
+
+	/*! Get eccentricity of the ellipse having the same second-order moments as the region.
+	*
+	* \return Eccentricity in [0, 1] (0 for circles and 1 for lines)
+	*/
+	double RegionMoments::getEccentricity(void) const {
+		double majorAxis, minorAxis;
+
+		getAxes(majorAxis, minorAxis);
+		if (majorAxis <= 0.0)
+			return 0.0;
+
+		double ratio = minorAxis / majorAxis;
+		return sqrt(std::max(1.0 - ratio * ratio, 0.0));
+	}
+
+	/*! Get Hu's seven moment invariants.
+	*
+	* Reference: M.-K. Hu: Visual pattern recognition by moment invariants, IRE Transactions on
+	* Information Theory 8(2), 1962, pp. 179-187.
+	*
+	* The invariants are invariant to translation, scaling, and rotation (hu[6] changes its sign for
+	* reflections).
+	*
+	* \param hu [out] Moment invariants
+	*/
+	void RegionMoments::getHuMoments(double hu[7]) const {
+		double n20 = getNormalized(2, 0), n11 = getNormalized(1, 1), n02 = getNormalized(0, 2);
+		double n30 = getNormalized(3, 0), n21 = getNormalized(2, 1), n12 = getNormalized(1, 2), n03 = getNormalized(0, 3);
+		double t0 = n30 + n12, t1 = n21 + n03;
+		double q0 = n30 - 3.0 * n12, q1 = 3.0 * n21 - n03;
+
+		hu[0] = n20 + n02;
+		hu[1] = (n20 - n02) * (n20 - n02) + 4.0 * n11 * n11;
+		hu[2] = q0 * q0 + q1 * q1;
+		hu[3] = t0 * t0 + t1 * t1;
+		hu[4] = q0 * t0 * (t0 * t0 - 3.0 * t1 * t1) + q1 * t1 * (3.0 * t0 * t0 - t1 * t1);
+		hu[5] = (n20 - n02) * (t0 * t0 - t1 * t1) + 4.0 * n11 * t0 * t1;
+		hu[6] = q1 * t0 * (t0 * t0 - 3.0 * t1 * t1) - q0 * t1 * (3.0 * t0 * t0 - t1 * t1);
+	}
+}
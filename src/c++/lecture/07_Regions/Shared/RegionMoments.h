@@ -0,0 +1,59 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_REGION_MOMENTS_H
+#define IP_REGION_MOMENTS_H
+
+/* Include files */
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/*! Accumulator of raw moments up to third order of a binary region.
+	*
+	* Raw moments m_pq = sum of x^p * y^q over all region pixels are accumulated in 64-bit integers,
+	* either pixel by pixel or for complete horizontal runs in closed form. Accumulators of region
+	* parts can be added, e.g., when regions merge during labeling. All shape descriptors are derived
+	* from the raw moments without accessing the image again.
+	*
+	* Third-order moments do not overflow for regions up to about 2^63 / max(x, y)^3 pixels
+	* (e.g., 20 megapixels with coordinates below 5000).
+	*/
+	class RegionMoments {
+	private:
+		int64_t m00, m10, m01, m20, m11, m02, m30, m21, m12, m03;
+
+	public:
+		RegionMoments(void);
+		void clear(void);
+
+		// Accumulate
+		void addPixel(int x, int y);
+		void addRun(int x0, int x1, int y);
+		void add(const RegionMoments& moments);
+
+		// Moments
+		int64_t getArea(void) const { return m00; }
+		int64_t getRaw(int p, int q) const;
+		double getCentral(int p, int q) const;
+		double getNormalized(int p, int q) const;
+		cv::Point2d getCentroid(void) const;
+
+		// Shape descriptors
+		double getOrientation(void) const;
+		void getAxes(double& majorAxis, double& minorAxis) const;
+		double getEccentricity(void) const;
+		void getHuMoments(double hu[7]) const;
+	};
+}
+
+#endif /* IP_REGION_MOMENTS_H */
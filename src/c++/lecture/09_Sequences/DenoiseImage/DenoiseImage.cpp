@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <opencv2/opencv.hpp>
 #include "Imaging.h"
+#include "FramePool.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")			// Read environment variable ImagingData
@@ -35,6 +36,10 @@ void onTrackbarAlpha(int value, void* alpha);
 /* Main function */
 int main()
 {
+	// Allocate all images from frame pool (no heap allocations per frame)
+	ip::FramePool& pool = ip::FramePool::getDefault();
+	pool.setAsDefaultAllocator();
+
 	// Load image from file
 	string inputImagePath = string(IMAGE_DATA_PATH).append(INPUT_IMAGE_RELATIVE_PATH);
 	Mat image = imread(inputImagePath);
@@ -75,6 +80,10 @@ int main()
 			break;
 	}
 
+	// Print allocation statistics
+	ip::framePoolStats poolStats = pool.getStatistics();
+	cout << "Frame pool: " << poolStats.numberAllocated << " buffers allocated, " << poolStats.numberReused << " reused" << endl;
+
 	return 0;
 }
 
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -17,6 +17,8 @@
 #include <opencv2/opencv.hpp>
 #include "VideoStream.h"
 #include "Imaging.h"
+#include "FramePool.h"
+#include "BlobTracker.h"
 
 /* Defines */
 #define IMAGE_DATA_PATH getenv("ImagingData")			// Read environment variable ImagingData
@@ -26,6 +28,7 @@
 #define WAIT_TIME_MS 150
 #define THRESHOLD 32
 #define MORPH_STRUCTURE_SIZE 7
+#define MIN_BLOB_AREA 100
 
 /* Namespaces */
 using namespace std;
@@ -34,11 +37,18 @@ using namespace cv;
 /* Main function */
 int main()
 {
+	// Allocate all images from frame pool (no heap allocations per frame)
+	ip::FramePool& pool = ip::FramePool::getDefault();
+	pool.setAsDefaultAllocator();
+
 	// Open video file
 	VideoStream video(string(IMAGE_DATA_PATH).append(VIDEO_RELATIVE_PATH));
 
 	// Init first image
 	Mat frame, grayImage, previousImage, deltaPlus, binary, mask;
+	Mat labels, stats, centroids;
+	ip::BlobTracker tracker;
+	vector<Rect> boxes;
 	video.getNextFrame(frame, &grayImage, SCALE_FACTOR);
 	previousImage = grayImage.clone();
 
@@ -58,6 +68,16 @@ int main()
 		Mat red(frame.size(), CV_8UC3, Scalar(0, 0, 255));
 		red.copyTo(frame, mask);
 
+		// Track BLOBS of mask across frames (bounding boxes of connected components)
+		int numberLabels = connectedComponentsWithStats(mask, labels, stats, centroids);
+		boxes.clear();
+		for (int label = 1; label < numberLabels; label++) {
+			if (stats.at<int>(label, CC_STAT_AREA) >= MIN_BLOB_AREA)
+				boxes.push_back(Rect(stats.at<int>(label, CC_STAT_LEFT), stats.at<int>(label, CC_STAT_TOP), stats.at<int>(label, CC_STAT_WIDTH), stats.at<int>(label, CC_STAT_HEIGHT)));
+		}
+		tracker.update(boxes);
+		tracker.annotate(frame);
+
 		// Display images
 		imshow("Frame", frame);
 		imshow("Positive difference", deltaPlus);
@@ -69,5 +89,9 @@ int main()
 			break;
 	}
 
+	// Print allocation statistics
+	ip::framePoolStats poolStats = pool.getStatistics();
+	cout << "Frame pool: " << poolStats.numberAllocated << " buffers allocated, " << poolStats.numberReused << " reused" << endl;
+
 	return 0;
 }
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -32,6 +32,7 @@ int main()
 {
 	// Open video file
 	VideoStream video(string(IMAGE_DATA_PATH).append(VIDEO_RELATIVE_PATH));
+	video.startAsync(4, DropPolicy::NEVER_DROP);		// Decode next frames while processing
 
 	// Init frame rate and first frame
 	Mat frame, frameMC, grayImage;
@@ -41,7 +42,7 @@ int main()
 	// Init template matching
 	TemplateMatcher matcher;
 	Rect2i roi((int)(0.1 * frame.cols), (int)(0.5 * frame.rows), (int)(0.3 * frame.rows), (int)(0.3 * frame.rows));
-	matcher.setTemplateImage(grayImage(roi).clone());
+	matcher.setTemplateImage(grayImage(roi).clone(), grayImage.size());
 
 	// Loop through frames
 	while (video.getNextFrame(frame, &grayImage, SCALE_FACTOR)) {
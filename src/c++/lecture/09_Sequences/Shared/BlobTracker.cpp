@@ -0,0 +1,328 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+/* Include files */
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include "BlobTracker.h"
+
+/* Namespaces */
+using namespace std;
+using namespace cv;
+
+namespace ip
+{
+	/* Weight of the latest displacement in the velocity estimate */
+	static const double VELOCITY_WEIGHT = 0.5;
+
+	/* Prototypes (module internal) */
+	static inline int64_t cellKey(int cx, int cy);
+	static inline int cellBucket(int cx, int cy, int numberBuckets);
+
+	/*****************************************************************************************************
+	 * Constructor and parameters
+	 *****************************************************************************************************/
+
+	/*! Constructor.
+	*
+	* \param cellSize [in] Size of grid cells in pixels (0 for twice the mean box size)
+	* \param minScore [in] Minimum score of a detection and a track to be associated
+	* \param scoreType [in] Score of overlapping boxes
+	* \param isPredict [in] Predict boxes by a constant velocity model before association
+	* \param birthHits [in] Number of subsequent detections to confirm a new track
+	* \param maxMisses [in] Number of subsequent frames without detection before a confirmed track is removed
+	*/
+	BlobTracker::BlobTracker(double cellSize, double minScore, OverlapScore scoreType, bool isPredict, int birthHits, int maxMisses) {
+		this->cellSize = cellSize;
+		this->minScore = minScore;
+		this->scoreType = scoreType;
+		this->isPredict = isPredict;
+		this->birthHits = std::max(birthHits, 1);
+		this->maxMisses = std::max(maxMisses, 0);
+		reset();
+	}
+
+	/*! Remove all tracks and restart IDs at 0.
+	*/
+	void BlobTracker::reset(void) {
+		tracks.clear();
+		nextId = 0;
+	}
+
+	/*****************************************************************************************************
+	 * Tracking
+	 *****************************************************************************************************/
+
+	/*! Associate detections of the next frame with tracks and update tracks.
+	*
+	* \param boxes [in] Bounding boxes of BLOBS detected in the frame
+	* \param ids [out] Persistent ID of each detection (-1 for tentative tracks) or NULL
+	*/
+	void BlobTracker::update(const vector<Rect>& boxes, vector<int>* ids) {
+		int numberTracks = (int)tracks.size();
+		int numberDetections = (int)boxes.size();
+
+		// Grid cell size (automatic: twice the mean box size)
+		double cell = cellSize;
+		if (cell <= 0.0) {
+			double sum = 0.0;
+			for (const Rect& box : boxes)
+				sum += std::max(box.width, box.height);
+			for (const blobTrack& track : tracks)
+				sum += std::max(track.box.width, track.box.height);
+			cell = (numberTracks + numberDetections > 0) ? 2.0 * sum / (numberTracks + numberDetections) : 1.0;
+			cell = std::max(cell, 1.0);
+		}
+
+		// Predict boxes by constant velocity
+		predicted.resize(numberTracks);
+		for (int t = 0; t < numberTracks; t++) {
+			predicted[t] = tracks[t].box;
+			if (isPredict) {
+				predicted[t].x += tracks[t].velocity.x;
+				predicted[t].y += tracks[t].velocity.y;
+			}
+		}
+
+		// Candidate pairs of overlapping boxes
+		hashTracks(cell);
+		findCandidates(boxes, cell);
+
+		// Greedy assignment in order of decreasing scores
+		sort(candidates.begin(), candidates.end(), [](const candidate& a, const candidate& b) {
+			if (a.score != b.score)
+				return a.score > b.score;
+			return (a.track != b.track) ? (a.track < b.track) : (a.detection < b.detection);
+		});
+
+		detectionTracks.assign(numberDetections, -1);
+		for (blobTrack& track : tracks)
+			track.detection = -1;
+
+		for (const candidate& pair : candidates) {
+			if ((tracks[pair.track].detection < 0) && (detectionTracks[pair.detection] < 0)) {
+				tracks[pair.track].detection = pair.detection;
+				detectionTracks[pair.detection] = pair.track;
+			}
+		}
+
+		// Update tracks and remove lost tracks (tentative: first miss, confirmed: more than maxMisses)
+		int numberKept = 0;
+		for (int t = 0; t < numberTracks; t++) {
+			blobTrack& track = tracks[t];
+			track.age++;
+
+			if (track.detection >= 0) {
+				// Velocity from displacement of box center
+				const Rect& box = boxes[track.detection];
+				Point2d displacement((box.x + 0.5 * box.width) - (track.box.x + 0.5 * track.box.width), (box.y + 0.5 * box.height) - (track.box.y + 0.5 * track.box.height));
+				if (track.age == 2)
+					track.velocity = displacement;
+				else
+					track.velocity = (1.0 - VELOCITY_WEIGHT) * track.velocity + VELOCITY_WEIGHT * displacement;
+
+				track.box = Rect2d(box.x, box.y, box.width, box.height);
+				track.hits++;
+				track.misses = 0;
+				if ((track.id < 0) && (track.hits >= birthHits))
+					track.id = nextId++;
+			}
+			else {
+				track.box = predicted[t];
+				track.hits = 0;
+				track.misses++;
+				if ((track.id < 0) || (track.misses > maxMisses))
+					continue;
+			}
+
+			if (track.detection >= 0)
+				detectionTracks[track.detection] = numberKept;
+			tracks[numberKept++] = track;
+		}
+		tracks.resize(numberKept);
+
+		// New tentative tracks for unassigned detections
+		for (int d = 0; d < numberDetections; d++) {
+			if (detectionTracks[d] >= 0)
+				continue;
+
+			blobTrack track;
+			track.box = Rect2d(boxes[d].x, boxes[d].y, boxes[d].width, boxes[d].height);
+			track.age = 1;
+			track.hits = 1;
+			track.detection = d;
+			if (birthHits <= 1)
+				track.id = nextId++;
+
+			detectionTracks[d] = (int)tracks.size();
+			tracks.push_back(track);
+		}
+
+		// IDs of detections
+		if (ids != NULL) {
+			ids->resize(numberDetections);
+			for (int d = 0; d < numberDetections; d++)
+				(*ids)[d] = tracks[detectionTracks[d]].id;
+		}
+	}
+
+	/*! Draw boxes and IDs of confirmed tracks (green: detected, yellow: predicted).
+	*
+	* \param image [in/out] Image to draw on (type CV_8UC3)
+	*/
+	void BlobTracker::annotate(Mat& image) const {
+		for (const blobTrack& track : tracks) {
+			if (track.id < 0)
+				continue;
+
+			Scalar color = (track.detection >= 0) ? Scalar(0, 255, 0) : Scalar(0, 255, 255);
+			Rect box((int)lround(track.box.x), (int)lround(track.box.y), (int)lround(track.box.width), (int)lround(track.box.height));
+			rectangle(image, box, color, 2);
+			putText(image, to_string(track.id), Point(box.x, box.y - 4), FONT_HERSHEY_SIMPLEX, 0.5, color, 1);
+		}
+	}
+
+	/*****************************************************************************************************
+	 * Association
+	 *****************************************************************************************************/
+
+	/*! Score of two overlapping boxes.
+	*
+	* \param a [in] First box
+	* \param b [in] Second box
+	* \return Intersection over union or over area of smaller box (0 if not overlapping)
+	*/
+	double BlobTracker::getScore(const Rect2d& a, const Rect2d& b) const {
+		double width = std::min(a.x + a.width, b.x + b.width) - std::max(a.x, b.x);
+		double height = std::min(a.y + a.height, b.y + b.height) - std::max(a.y, b.y);
+		if ((width <= 0.0) || (height <= 0.0))
+			return 0.0;
+
+		double intersection = width * height;
+		double areaA = a.width * a.height, areaB = b.width * b.height;
+
+		if (scoreType == OverlapScore::IOU)
+			return intersection / (areaA + areaB - intersection);
+		else
+			return intersection / std::min(areaA, areaB);
+	}
+
+	/*! Insert predicted track boxes into a hashed uniform grid.
+	*
+	* Each box is entered into all cells it covers. Entries are sorted into hash buckets by counting
+	* sort, so that building the grid is linear in the number of entries.
+	*
+	* \param cell [in] Size of grid cells in pixels
+	*/
+	void BlobTracker::hashTracks(double cell) {
+		entryCells.clear();
+		entryTracks.clear();
+
+		for (int t = 0; t < (int)predicted.size(); t++) {
+			const Rect2d& box = predicted[t];
+			int cx0 = (int)floor(box.x / cell), cx1 = (int)floor((box.x + box.width) / cell);
+			int cy0 = (int)floor(box.y / cell), cy1 = (int)floor((box.y + box.height) / cell);
+
+			for (int cy = cy0; cy <= cy1; cy++) {
+				for (int cx = cx0; cx <= cx1; cx++) {
+					entryCells.push_back(cellKey(cx, cy));
+					entryTracks.push_back(t);
+				}
+			}
+		}
+
+		// Number of buckets (power of 2, at least twice the number of entries)
+		int numberBuckets = 1;
+		while (numberBuckets < 2 * (int)entryCells.size())
+			numberBuckets *= 2;
+
+		// Counting sort of entries by bucket
+		bucketStart.assign(numberBuckets + 1, 0);
+		for (int64_t key : entryCells)
+			bucketStart[cellBucket((int)(uint32_t)key, (int)(key >> 32), numberBuckets) + 1]++;
+		for (int b = 0; b < numberBuckets; b++)
+			bucketStart[b + 1] += bucketStart[b];
+
+		bucketCells.resize(entryCells.size());
+		bucketTracks.resize(entryTracks.size());
+		for (size_t e = 0; e < entryCells.size(); e++) {
+			int64_t key = entryCells[e];
+			int b = cellBucket((int)(uint32_t)key, (int)(key >> 32), numberBuckets);
+			int index = bucketStart[b]++;
+			bucketCells[index] = key;
+			bucketTracks[index] = entryTracks[e];
+		}
+
+		// Restore bucket starts (shifted by filling)
+		for (int b = numberBuckets; b > 0; b--)
+			bucketStart[b] = bucketStart[b - 1];
+		bucketStart[0] = 0;
+	}
+
+	/*! Score tracks sharing grid cells with detections.
+	*
+	* Overlapping boxes share at least one cell. Each pair is scored once.
+	*
+	* \param boxes [in] Bounding boxes of detections
+	* \param cell [in] Size of grid cells in pixels
+	*/
+	void BlobTracker::findCandidates(const vector<Rect>& boxes, double cell) {
+		int numberBuckets = (int)bucketStart.size() - 1;
+		candidates.clear();
+		visited.assign(predicted.size(), -1);
+
+		for (int d = 0; d < (int)boxes.size(); d++) {
+			Rect2d box(boxes[d].x, boxes[d].y, boxes[d].width, boxes[d].height);
+			int cx0 = (int)floor(box.x / cell), cx1 = (int)floor((box.x + box.width) / cell);
+			int cy0 = (int)floor(box.y / cell), cy1 = (int)floor((box.y + box.height) / cell);
+
+			for (int cy = cy0; cy <= cy1; cy++) {
+				for (int cx = cx0; cx <= cx1; cx++) {
+					int64_t key = cellKey(cx, cy);
+					int b = cellBucket(cx, cy, numberBuckets);
+
+					for (int e = bucketStart[b]; e < bucketStart[b + 1]; e++) {
+						int t = bucketTracks[e];
+						if ((bucketCells[e] != key) || (visited[t] == d))
+							continue;
+
+						visited[t] = d;
+						double score = getScore(predicted[t], box);
+						if ((score > 0.0) && (score >= minScore))
+							candidates.push_back({ score, t, d });
+					}
+				}
+			}
+		}
+	}
+
+	/*! Key of a grid cell.
+	*
+	* \param cx [in] Column of cell
+	* \param cy [in] Row of cell
+	* \return Unique key (row in upper, column in lower 32 bits)
+	*/
+	static inline int64_t cellKey(int cx, int cy) {
+		return (int64_t)(((uint64_t)(uint32_t)cy << 32) | (uint32_t)cx);
+	}
+
+	/*! Hash bucket of a grid cell.
+	*
+	* \param cx [in] Column of cell
+	* \param cy [in] Row of cell
+	* \param numberBuckets [in] Number of buckets (power of 2)
+	* \return Bucket index
+	*/
+	static inline int cellBucket(int cx, int cy, int numberBuckets) {
+		uint32_t hash = ((uint32_t)cx * 73856093u) ^ ((uint32_t)cy * 19349663u);
+		return (int)(hash & (uint32_t)(numberBuckets - 1));
+	}
+}
@@ -0,0 +1,90 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_BLOB_TRACKER_H
+#define IP_BLOB_TRACKER_H
+
+/* Include files */
+#include <cstdint>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Score of overlapping bounding boxes */
+	enum class OverlapScore {
+		IOU,			// Intersection over union
+		MIN_AREA		// Intersection over area of smaller box (tolerates strongly changing sizes)
+	};
+
+	/* Track of a BLOB across frames */
+	typedef struct blobTrack {
+		int id = -1;				// Persistent ID (-1 while tentative)
+		cv::Rect2d box;				// Bounding box (predicted, if not detected in current frame)
+		cv::Point2d velocity;		// Motion of box center in pixels per frame
+		int age = 0;				// Number of frames since birth
+		int hits = 0;				// Number of consecutive frames with detection
+		int misses = 0;				// Number of consecutive frames without detection
+		int detection = -1;			// Index of detection in current frame (-1 if not detected)
+	} blobTrack;
+
+	/*! Tracking of BLOBS by overlap of their bounding boxes in subsequent frames.
+	*
+	* Detections of a frame are associated with the tracks of the previous frames. Candidate pairs are
+	* found by a uniform grid hashing the cells covered by the (predicted) track boxes, so that only
+	* nearby boxes are scored and association costs are close to linear in the number of BLOBS.
+	* Pairs are assigned greedily in the order of decreasing scores.
+	*
+	* Tracks are born and killed with hysteresis: A new track is tentative and gets a persistent ID
+	* after a number of subsequent detections. Tentative tracks are removed when not detected, confirmed
+	* tracks only after a number of subsequent frames without detection.
+	*/
+	class BlobTracker {
+	private:
+		// Parameters
+		double cellSize;				// Size of grid cells in pixels (0 for automatic size)
+		double minScore;				// Minimum score of associated boxes
+		OverlapScore scoreType;			// Score of overlapping boxes
+		bool isPredict;					// Predict boxes by constant velocity model
+		int birthHits;					// Subsequent detections to confirm a track
+		int maxMisses;					// Subsequent frames without detection before a confirmed track is removed
+
+		// Tracks
+		std::vector<blobTrack> tracks;
+		int nextId;
+
+		// Working memory (reused in each frame)
+		typedef struct candidate { double score; int track, detection; } candidate;
+		std::vector<cv::Rect2d> predicted;
+		std::vector<int64_t> entryCells, bucketCells;	// Grid cells covered by track boxes (unsorted and by buckets)
+		std::vector<int> entryTracks, bucketTracks;		// Tracks of cells (unsorted and by buckets)
+		std::vector<int> bucketStart;					// Index of first entry of each hash bucket
+		std::vector<int> visited;						// Last detection a track has been scored with
+		std::vector<candidate> candidates;
+		std::vector<int> detectionTracks;
+
+	public:
+		BlobTracker(double cellSize = 0.0, double minScore = 0.1, OverlapScore scoreType = OverlapScore::IOU, bool isPredict = true, int birthHits = 3, int maxMisses = 5);
+		void reset(void);
+
+		// Tracking
+		void update(const std::vector<cv::Rect>& boxes, std::vector<int>* ids = NULL);
+		const std::vector<blobTrack>& getTracks(void) const { return tracks; }
+		void annotate(cv::Mat& image) const;
+
+	private:
+		double getScore(const cv::Rect2d& a, const cv::Rect2d& b) const;
+		void hashTracks(double cell);
+		void findCandidates(const std::vector<cv::Rect>& boxes, double cell);
+	};
+}
+
+#endif /* IP_BLOB_TRACKER_H */
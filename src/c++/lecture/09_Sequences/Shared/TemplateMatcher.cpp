@@ -4,15 +4,24 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
 /* Include files */
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include "TemplateMatcher.h"
 
-TemplateMatcher::TemplateMatcher(void) {
+/*! Constructor.
+* 
+* \param method Spatial or frequency domain (automatic selection by template area, if AUTO)
+*/
+TemplateMatcher::TemplateMatcher(MatchMethod method) {
 	// Init match results
+	this->method = method;
+	this->templateNorm = 0.0;
 	resetResults();
 
 	// Init BLOB detector
@@ -29,15 +38,42 @@ TemplateMatcher::TemplateMatcher(void) {
 
 /*! Set a new image template.
 * 
+* For single-channel templates, the zero-mean template is prepared for correlation in the frequency
+* domain. If the size of the images to search is known, the template's DFT is computed at once.
+* Else, it is computed in the first call of match() and reused as long as the image size is the same.
+* 
 * \param image Image to be used as matching template
+* \param searchSize Size of images to search (or empty size, if unknown)
 */
-void TemplateMatcher::setTemplateImage(const Mat& image) {
+void TemplateMatcher::setTemplateImage(const Mat& image, Size searchSize) {
 	if (!image.empty()) {
 		this->templateImage = image.clone();
 		resetResults();
+
+		// Zero-mean template and its norm
+		this->spectrumSize = Size();
+		this->templateSpectrum = Mat();
+		if (image.channels() == 1) {
+			image.convertTo(this->zeroMeanTemplate, CV_32F);
+			this->zeroMeanTemplate -= mean(this->zeroMeanTemplate);
+			this->templateNorm = norm(this->zeroMeanTemplate, NORM_L2);
+
+			if ((searchSize.width >= image.cols) && (searchSize.height >= image.rows))
+				computeTemplateSpectrum(Size(getOptimalDFTSize(searchSize.width), getOptimalDFTSize(searchSize.height)));
+		}
+		else
+			this->zeroMeanTemplate = Mat();
 	}
 }
 
+/*! Set domain to compute normalized correlation coefficients in.
+* 
+* \param method Spatial or frequency domain (automatic selection by template area, if AUTO)
+*/
+void TemplateMatcher::setMethod(MatchMethod method) {
+	this->method = method;
+}
+
 /*! Perform template matching.
 * 
 * \param image Image to search for template
@@ -50,7 +86,10 @@ void TemplateMatcher::match(const Mat& image, Point2i* bestMatch, double* bestMa
 
 	// Template matching
 	if (!(this->templateImage.empty()) && !(image.empty())) {
-		matchTemplate(image, this->templateImage, this->correlationMap, TM_CCOEFF_NORMED);
+		if (isFrequencyDomain(image))
+			matchFrequencyDomain(image);
+		else
+			matchTemplate(image, this->templateImage, this->correlationMap, TM_CCOEFF_NORMED);
 		this->isValidMatch = !(this->correlationMap.empty());
 	}
 
@@ -109,3 +148,97 @@ void TemplateMatcher::resetResults(void) {
 	this->isValidMatch = false;
 	this->correlationMap = Mat();
 }
+
+/*! Check whether to compute the correlation coefficients in the frequency domain.
+* 
+* \param image Image to search for template
+* \returns true, if the method and images allow for correlation in the frequency domain
+*/
+bool TemplateMatcher::isFrequencyDomain(const Mat& image) const {
+	bool isApplicable = !(this->zeroMeanTemplate.empty()) && (image.channels() == 1) && ((image.depth() == CV_8U) || (image.depth() == CV_32F))
+		&& (image.cols >= this->templateImage.cols) && (image.rows >= this->templateImage.rows);
+
+	if (this->method == MatchMethod::AUTO)
+		return isApplicable && (this->templateImage.total() >= FFT_MIN_TEMPLATE_AREA);
+	else
+		return isApplicable && (this->method == MatchMethod::FFT);
+}
+
+/*! Compute the DFT of the zero-padded zero-mean template.
+* 
+* \param dftSize DFT size (at least the size of the images to search)
+*/
+void TemplateMatcher::computeTemplateSpectrum(Size dftSize) {
+	Mat padded = Mat::zeros(dftSize, CV_32F);
+	this->zeroMeanTemplate.copyTo(padded(Rect(0, 0, this->zeroMeanTemplate.cols, this->zeroMeanTemplate.rows)));
+	dft(padded, this->templateSpectrum, 0, this->zeroMeanTemplate.rows);
+	this->spectrumSize = dftSize;
+}
+
+/*! Compute normalized correlation coefficients (TM_CCOEFF_NORMED) in the frequency domain.
+* 
+* The template T' has zero mean, so that the sum of T' * I over the template window equals the
+* numerator of the correlation coefficient. The sums are computed for all template locations by
+* multiplying the image's DFT with the conjugate template DFT. A DFT size of at least the image size
+* avoids wrap-around for all locations with the template completely inside the image. The image mean
+* is subtracted beforehand, which does not change the result, but improves the float precision.
+* 
+* The denominator requires sum and sum of squares of the image in each template window, which are
+* taken from integral images. Windows of (almost) constant gray value are handled as by OpenCV.
+* 
+* \param image Image to search for template (single channel)
+*/
+void TemplateMatcher::matchFrequencyDomain(const Mat& image) {
+	int width = this->templateImage.cols, height = this->templateImage.rows;
+	int resultCols = image.cols - width + 1, resultRows = image.rows - height + 1;
+	this->correlationMap.create(resultRows, resultCols, CV_32F);
+
+	// Constant template (as by OpenCV)
+	double area = (double)width * height;
+	if (this->templateNorm * this->templateNorm / area < DBL_EPSILON) {
+		this->correlationMap.setTo(Scalar::all(1.0));
+		return;
+	}
+
+	// Template spectrum (computed once for each image size)
+	Size dftSize(getOptimalDFTSize(image.cols), getOptimalDFTSize(image.rows));
+	if (dftSize != this->spectrumSize)
+		computeTemplateSpectrum(dftSize);
+
+	// Correlation of zero-mean image and zero-mean template
+	this->paddedImage.create(dftSize, CV_32F);
+	image.convertTo(this->paddedImage(Rect(0, 0, image.cols, image.rows)), CV_32F, 1.0, -mean(image)[0]);
+	this->paddedImage(Rect(image.cols, 0, dftSize.width - image.cols, image.rows)).setTo(Scalar::all(0.0));
+	this->paddedImage(Rect(0, image.rows, dftSize.width, dftSize.height - image.rows)).setTo(Scalar::all(0.0));
+
+	dft(this->paddedImage, this->imageSpectrum, 0, image.rows);
+	mulSpectrums(this->imageSpectrum, this->templateSpectrum, this->imageSpectrum, 0, true);
+	dft(this->imageSpectrum, this->paddedImage, DFT_INVERSE | DFT_SCALE | DFT_REAL_OUTPUT, resultRows);
+
+	// Normalization by sums over template windows
+	integral(image, this->windowSum, this->windowSqSum, CV_64F, CV_64F);
+	double invArea = 1.0 / area;
+
+	for (int y = 0; y < resultRows; y++) {
+		const double* sumTop = this->windowSum.ptr<double>(y);
+		const double* sumBottom = this->windowSum.ptr<double>(y + height);
+		const double* sqSumTop = this->windowSqSum.ptr<double>(y);
+		const double* sqSumBottom = this->windowSqSum.ptr<double>(y + height);
+		const float* numerators = this->paddedImage.ptr<float>(y);
+		float* coefficients = this->correlationMap.ptr<float>(y);
+
+		for (int x = 0; x < resultCols; x++) {
+			double sum = sumBottom[x + width] - sumBottom[x] - sumTop[x + width] + sumTop[x];
+			double sqSum = sqSumBottom[x + width] - sqSumBottom[x] - sqSumTop[x + width] + sqSumTop[x];
+			double denominator = sqrt(std::max(sqSum - sum * sum * invArea, 0.0)) * this->templateNorm;
+			double numerator = numerators[x];
+
+			if (fabs(numerator) < denominator)
+				coefficients[x] = (float)(numerator / denominator);
+			else if (fabs(numerator) < 1.125 * denominator)
+				coefficients[x] = (numerator > 0.0) ? 1.0f : -1.0f;
+			else
+				coefficients[x] = 0.0f;
+		}
+	}
+}
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -19,22 +19,46 @@
 using namespace std;
 using namespace cv;
 
+/* Defines */
+#define FFT_MIN_TEMPLATE_AREA 1024		// Min. template area (in pixels) to correlate in frequency domain
+
+/* Computation of normalized correlation coefficients */
+enum class MatchMethod {
+	AUTO,		// Frequency domain for templates of area >= FFT_MIN_TEMPLATE_AREA, else spatial domain
+	SPATIAL,	// Spatial domain (OpenCV's matchTemplate())
+	FFT			// Frequency domain (single-channel images only)
+};
+
 class TemplateMatcher {
 private:
 	Mat templateImage;						// Reference image to match
 	Mat correlationMap;						// Normalized correlation coefficient (result of matching)
 	bool isValidMatch;						// True, if match has been done (i. e., correlationMap contains valid results)
 	Ptr<SimpleBlobDetector> blobDetector;	// Blob detection used to find all matches above a threshold in getMatches()
+	MatchMethod method;						// Spatial or frequency domain
+
+	// Correlation in frequency domain
+	Mat zeroMeanTemplate;					// Template minus its mean value (CV_32F)
+	double templateNorm;					// Square root of sum of squared zero-mean template values
+	Mat templateSpectrum;					// DFT of zero-padded zero-mean template (CCS packed)
+	Size spectrumSize;						// DFT size of templateSpectrum (empty, if not computed)
+	Mat paddedImage;						// Zero-padded search image and inverse DFT result (reused)
+	Mat imageSpectrum;						// DFT of search image (reused)
+	Mat windowSum, windowSqSum;				// Integral images of search image (reused)
 
 public:
-	TemplateMatcher(void);
-	void setTemplateImage(const Mat& image);
+	TemplateMatcher(MatchMethod method = MatchMethod::AUTO);
+	void setTemplateImage(const Mat& image, Size searchSize = Size());
+	void setMethod(MatchMethod method);
 	void match(const Mat& image, Point2i* bestMatch = NULL, double* bestMatchCorrelation = NULL);
 	Mat getCorrelationMap(void);
 	vector<Point2i> getMatches(double corrThreshold);
 
 private:
 	void resetResults(void);
+	bool isFrequencyDomain(const Mat& image) const;
+	void computeTemplateSpectrum(Size dftSize);
+	void matchFrequencyDomain(const Mat& image);
 };
 
 #endif /* TEMPLATE_MATCHER_H */
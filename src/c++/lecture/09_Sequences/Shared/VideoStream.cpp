@@ -4,18 +4,24 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
 /* Include files */
 #include "VideoStream.h"
+#include "FramePool.h"
+
+/* Prototypes (module internal) */
+static void computeAreaTable(int sourceLength, int targetLength, vector<int>& start, vector<int>& index, vector<float>& weight);
 
 VideoStream::VideoStream(int cameraId) {
 	this->capture = VideoCapture(cameraId);
 
 	if (!(this->capture.isOpened()))
 		throw exception("Cannot open camera");
+
+	init();
 }
 
 VideoStream::VideoStream(string fileName) {
@@ -23,39 +29,351 @@ VideoStream::VideoStream(string fileName) {
 
 	if (!(this->capture.isOpened()))
 		throw exception("Cannot open video file");
+
+	init();
 }
 
 VideoStream::~VideoStream(void) {
+	stopAsync();
+
 	if (this->capture.isOpened())
 		this->capture.release();
 }
 
+/*! Init members after opening the video source (synchronous mode).
+*/
+void VideoStream::init(void) {
+	this->framesPerSecond = this->capture.get(CAP_PROP_FPS);
+	this->ringHead = this->ringCount = 0;
+	this->dropPolicy = DropPolicy::NEVER_DROP;
+	this->isAsync = this->isStopping = this->isEndOfStream = false;
+	this->numberDecoded = this->numberDropped = 0;
+}
+
 double VideoStream::getFramesPerSecond(void) {
-	return this->capture.get(CAP_PROP_FPS);
+	return this->framesPerSecond;
 }
 
 /*! Get next frame from the camera or video file.
 *
+* In asynchronous mode, the frame is taken from the ring buffer filled by the decoder thread.
+*
 * \param frame Frame from video source
 * \param grayImage Frame converted to an gray image
 * \param scaleFactor Factor to scale / resize the grabbed frame's width and height with
 * \return true if a non-empty frame was captured
 */
 bool VideoStream::getNextFrame(Mat& frame, Mat* grayImage, double scaleFactor) {
-	// Get next frame from file or camera
-	this->capture >> frame;
+	bool isScaled = (abs(scaleFactor - 1.0) > 1.0e-6);
+	const Mat* source = &frame;
 
-	if (!frame.empty()) {
-		// Scale frame
-		if (abs(scaleFactor - 1.0) > 1.0e-6)
-			resize(frame, frame, Size(), scaleFactor, scaleFactor, INTER_CUBIC);
+	// Allocate frames from pool (unless caller has set an allocator)
+	ip::FramePool& pool = ip::FramePool::getDefault();
+	this->decodedFrame.allocator = &pool;
+	if (frame.allocator == NULL)
+		frame.allocator = &pool;
+	if ((grayImage != NULL) && (grayImage->allocator == NULL))
+		grayImage->allocator = &pool;
 
-		// Convert to gray image
-		if (grayImage != NULL)
-			cvtColor(frame, *grayImage, COLOR_BGR2GRAY);
+	// Get next frame from file or camera (or from ring buffer)
+	if (this->isAsync) {
+		if (!dequeueFrame())
+			return false;
+		source = &(this->outputBuffer);
+	}
+	else if (isScaled) {
+		this->capture >> this->decodedFrame;
+		source = &(this->decodedFrame);
+	}
+	else
+		this->capture >> frame;
 
+	if (source->empty())
+		return false;
+
+	// Downscale and convert to gray image in one pass
+	if (isScaled && (scaleFactor < 1.0) && (source->type() == CV_8UC3)) {
+		scaleAndConvert(*source, frame, grayImage, scaleFactor);
 		return true;
 	}
-	else
+
+	// Scale frame
+	if (isScaled)
+		resize(*source, frame, Size(), scaleFactor, scaleFactor, INTER_CUBIC);
+	else if (source != &frame)
+		source->copyTo(frame);
+
+	// Convert to gray image
+	if (grayImage != NULL)
+		cvtColor(frame, *grayImage, COLOR_BGR2GRAY);
+
+	return true;
+}
+
+/*! Downscale BGR frame by area averaging and convert it to a gray image in one pass.
+*
+* Each target pixel is the weighted mean of the source pixels it covers (as INTER_AREA). Source rows
+* are averaged horizontally once and accumulated into the target row, from which the scaled frame
+* and the gray image are written together. Tables of source indices and weights are computed once
+* per frame size. Target images are reused, if they have the target size and type.
+*
+* \param source Decoded frame (type CV_8UC3)
+* \param frame Scaled frame
+* \param grayImage Scaled frame converted to a gray image (or NULL)
+* \param scaleFactor Factor < 1 to scale the frame's width and height with
+*/
+void VideoStream::scaleAndConvert(const Mat& source, Mat& frame, Mat* grayImage, double scaleFactor) {
+	Size targetSize(max((int)lround(source.cols * scaleFactor), 1), max((int)lround(source.rows * scaleFactor), 1));
+
+	// Tables of source pixels covered by target pixels
+	if ((source.size() != this->tableSourceSize) || (targetSize != this->tableTargetSize)) {
+		computeAreaTable(source.cols, targetSize.width, this->columnStart, this->columnIndex, this->columnWeight);
+		computeAreaTable(source.rows, targetSize.height, this->rowStart, this->rowIndex, this->rowWeight);
+		this->tableSourceSize = source.size();
+		this->tableTargetSize = targetSize;
+	}
+
+	frame.create(targetSize, CV_8UC3);
+	if (grayImage != NULL)
+		grayImage->create(targetSize, CV_8U);
+
+	this->rowSum.resize(3 * targetSize.width);
+	this->areaSum.resize(3 * targetSize.width);
+	float* rowValues = this->rowSum.data();
+	float* areaValues = this->areaSum.data();
+	int averagedRow = -1;
+
+	for (int y = 0; y < targetSize.height; y++) {
+		fill(this->areaSum.begin(), this->areaSum.end(), 0.0f);
+
+		for (int k = this->rowStart[y]; k < this->rowStart[y + 1]; k++) {
+			// Average source row horizontally (once for rows shared by two target rows)
+			int sourceRow = this->rowIndex[k];
+			if (sourceRow != averagedRow) {
+				const uchar* sourcePixels = source.ptr<uchar>(sourceRow);
+
+				for (int x = 0; x < targetSize.width; x++) {
+					float b = 0.0f, g = 0.0f, r = 0.0f;
+					for (int j = this->columnStart[x]; j < this->columnStart[x + 1]; j++) {
+						const uchar* pixel = sourcePixels + 3 * this->columnIndex[j];
+						float weight = this->columnWeight[j];
+						b += weight * pixel[0];
+						g += weight * pixel[1];
+						r += weight * pixel[2];
+					}
+					rowValues[3 * x] = b;
+					rowValues[3 * x + 1] = g;
+					rowValues[3 * x + 2] = r;
+				}
+				averagedRow = sourceRow;
+			}
+
+			// Accumulate into target row
+			float weight = this->rowWeight[k];
+			for (int i = 0; i < 3 * targetSize.width; i++)
+				areaValues[i] += weight * rowValues[i];
+		}
+
+		// Write scaled BGR frame and gray image (weights as COLOR_BGR2GRAY)
+		uchar* framePixels = frame.ptr<uchar>(y);
+		for (int i = 0; i < 3 * targetSize.width; i++)
+			framePixels[i] = saturate_cast<uchar>(areaValues[i]);
+
+		if (grayImage != NULL) {
+			uchar* grayPixels = grayImage->ptr<uchar>(y);
+			for (int x = 0; x < targetSize.width; x++)
+				grayPixels[x] = saturate_cast<uchar>(0.114f * areaValues[3 * x] + 0.587f * areaValues[3 * x + 1] + 0.299f * areaValues[3 * x + 2]);
+		}
+	}
+}
+
+/*! Compute source pixels and weights of target pixels for downscaling by area averaging.
+*
+* Target pixel i covers the source interval [i * s, (i + 1) * s) with s = sourceLength / targetLength.
+* Source pixels partially covered are weighted by the covered fraction. Weights sum up to 1.
+*
+* \param sourceLength Number of source pixels (columns or rows)
+* \param targetLength Number of target pixels (at most sourceLength)
+* \param start Index of the first entry of each target pixel in index and weight (targetLength + 1 entries)
+* \param index Source pixels
+* \param weight Weights of source pixels
+*/
+static void computeAreaTable(int sourceLength, int targetLength, vector<int>& start, vector<int>& index, vector<float>& weight) {
+	double scale = (double)sourceLength / targetLength;
+
+	start.resize(targetLength + 1);
+	index.clear();
+	weight.clear();
+
+	for (int i = 0; i < targetLength; i++) {
+		double begin = i * scale, end = min((i + 1) * scale, (double)sourceLength);
+		start[i] = (int)index.size();
+
+		for (int j = (int)floor(begin); (j < sourceLength) && (j < end); j++) {
+			double covered = min(end, j + 1.0) - max(begin, (double)j);
+			if (covered > 1.0e-9) {
+				index.push_back(j);
+				weight.push_back((float)(covered / scale));
+			}
+		}
+	}
+	start[targetLength] = (int)index.size();
+}
+
+/*! Start decoding frames in a separate thread (asynchronous mode).
+*
+* The decoder thread reads frames into a ring buffer while the caller processes previous frames,
+* so that decoding and processing overlap on separate cores. Frame buffers are taken from the
+* default ip::FramePool once and recycled by swapping them between decoder, ring, and caller.
+* getNextFrame() waits, if the ring is empty. With policy NEVER_DROP, it takes the oldest frame
+* (FIFO). With policy LATEST_ONLY, it takes the newest frame and drops all older queued frames.
+*
+* \param capacity Number of frames in the ring buffer
+* \param policy Process newest frame only (live cameras) or each frame (video files)
+*/
+void VideoStream::startAsync(int capacity, DropPolicy policy) {
+	if (this->isAsync)
+		return;
+
+	// Preallocate frames from pool (BGR frames of video source's size)
+	ip::FramePool& pool = ip::FramePool::getDefault();
+	int width = (int)this->capture.get(CAP_PROP_FRAME_WIDTH);
+	int height = (int)this->capture.get(CAP_PROP_FRAME_HEIGHT);
+
+	this->ring.resize(max(capacity, 1));
+	for (Mat& slot : this->ring)
+		slot.allocator = &pool;
+	this->decodeBuffer.allocator = &pool;
+	this->outputBuffer.allocator = &pool;
+
+	if ((width > 0) && (height > 0)) {
+		for (Mat& slot : this->ring)
+			slot.create(height, width, CV_8UC3);
+		this->decodeBuffer.create(height, width, CV_8UC3);
+		this->outputBuffer.create(height, width, CV_8UC3);
+	}
+
+	// Start decoder thread
+	this->ringHead = this->ringCount = 0;
+	this->dropPolicy = policy;
+	this->isStopping = this->isEndOfStream = false;
+	this->numberDecoded = this->numberDropped = 0;
+	this->isAsync = true;
+	this->decoder = thread(&VideoStream::decodeFrames, this);
+}
+
+/*! Stop decoder thread and return to synchronous mode.
+*
+* Frames still queued in the ring buffer are discarded.
+*/
+void VideoStream::stopAsync(void) {
+	if (!this->isAsync)
+		return;
+
+	{
+		lock_guard<mutex> lock(this->ringMutex);
+		this->isStopping = true;
+	}
+	this->isNotFull.notify_all();
+
+	if (this->decoder.joinable())
+		this->decoder.join();
+
+	this->ringHead = this->ringCount = 0;
+	this->isAsync = false;
+}
+
+/*! Get number of decoded frames waiting in the ring buffer.
+*
+* \return Queue depth (0 in synchronous mode)
+*/
+int VideoStream::getQueueDepth(void) {
+	lock_guard<mutex> lock(this->ringMutex);
+	return this->ringCount;
+}
+
+/*! Get number of frames decoded since asynchronous mode has been started.
+*
+* \return Number of decoded frames
+*/
+uint64_t VideoStream::getNumberDecoded(void) {
+	lock_guard<mutex> lock(this->ringMutex);
+	return this->numberDecoded;
+}
+
+/*! Get number of decoded frames dropped, because the ring was full or a newer frame has been taken (policy LATEST_ONLY).
+*
+* \return Number of dropped frames
+*/
+uint64_t VideoStream::getNumberDropped(void) {
+	lock_guard<mutex> lock(this->ringMutex);
+	return this->numberDropped;
+}
+
+/*! Take frame from ring buffer into outputBuffer (wait, if ring is empty).
+*
+* Policy NEVER_DROP takes the oldest frame. Policy LATEST_ONLY takes the newest frame and drops
+* the older ones, so that a live camera's most recent frame is processed.
+*
+* \return true if a frame was taken, false at end of stream
+*/
+bool VideoStream::dequeueFrame(void) {
+	unique_lock<mutex> lock(this->ringMutex);
+	this->isNotEmpty.wait(lock, [this] { return (this->ringCount > 0) || this->isEndOfStream; });
+
+	if (this->ringCount == 0)
 		return false;
+
+	int capacity = (int)this->ring.size();
+	if (this->dropPolicy == DropPolicy::LATEST_ONLY) {
+		this->numberDropped += this->ringCount - 1;
+		this->ringHead = (this->ringHead + this->ringCount - 1) % capacity;
+		this->ringCount = 1;
+	}
+
+	swap(this->outputBuffer, this->ring[this->ringHead]);
+	this->ringHead = (this->ringHead + 1) % capacity;
+	this->ringCount--;
+	this->isNotFull.notify_one();
+
+	return true;
+}
+
+/*! Decoder thread: Read frames from capture and queue them in the ring buffer.
+*/
+void VideoStream::decodeFrames(void) {
+	int capacity = (int)this->ring.size();
+
+	while (true) {
+		// Decode next frame (without blocking the caller)
+		bool isValid = this->capture.read(this->decodeBuffer) && !(this->decodeBuffer.empty());
+		unique_lock<mutex> lock(this->ringMutex);
+
+		if (this->isStopping)
+			return;
+
+		if (!isValid) {
+			this->isEndOfStream = true;
+			this->isNotEmpty.notify_all();
+			return;
+		}
+		this->numberDecoded++;
+
+		// Ring full: Wait for free slot or drop oldest frame
+		if (this->dropPolicy == DropPolicy::NEVER_DROP) {
+			this->isNotFull.wait(lock, [this, capacity] { return (this->ringCount < capacity) || this->isStopping; });
+			if (this->isStopping)
+				return;
+		}
+		else if (this->ringCount == capacity) {
+			this->ringHead = (this->ringHead + 1) % capacity;
+			this->ringCount--;
+			this->numberDropped++;
+		}
+
+		// Queue frame (swap buffers to recycle memory)
+		swap(this->ring[(this->ringHead + this->ringCount) % capacity], this->decodeBuffer);
+		this->ringCount++;
+		this->isNotEmpty.notify_one();
+	}
 }
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.27
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -133,7 +133,7 @@ bool setTemplateImage(const Image& image, Rect2i roi) {
 
 	if (isInImage) {
 		Mat templateImage = image.gray(roi).clone();
-		matcher.setTemplateImage(templateImage);
+		matcher.setTemplateImage(templateImage, image.gray.size());
 		imshow(WIN_NAME_TEMPLATE, templateImage);
 		return true;
 	} else
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.12.15
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -43,6 +43,7 @@ int main()
 {
 	// Open camera
 	VideoStream camera(CAMERA_ID);
+	camera.startAsync(2, DropPolicy::LATEST_ONLY);		// Always process most recent frame
 
 	// Init ROI
 	camera.getNextFrame(frame, &grayImage);
@@ -92,7 +93,7 @@ void setTemplateImage(const Mat& image, Rect2i roi) {
 
 	if (isInImage) {
 		Mat templateImage = image(roi).clone();
-		matcher.setTemplateImage(templateImage);
+		matcher.setTemplateImage(templateImage, image.size());
 		imshow(WIN_NAME_TEMPLATE, templateImage);
 	}
 }
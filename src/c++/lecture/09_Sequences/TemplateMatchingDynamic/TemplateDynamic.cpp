@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.12.15
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -82,7 +82,7 @@ int main()
 		// Update template image if correlation >= min. update value
 		if (bestMatchCorr >= minUpdateCorr) {
 			Mat templateImage = grayImage(roi).clone();
-			matcher.setTemplateImage(templateImage);
+			matcher.setTemplateImage(templateImage, grayImage.size());
 			imshow(WIN_NAME_TEMPLATE, templateImage);
 		}
 
@@ -106,7 +106,7 @@ void setTemplateImage(const Mat& image, Rect2i roi) {
 
 	if (isInImage) {
 		Mat templateImage = image(roi).clone();
-		matcher.setTemplateImage(templateImage);
+		matcher.setTemplateImage(templateImage, image.size());
 		imshow(WIN_NAME_TEMPLATE, templateImage);
 	}
 }
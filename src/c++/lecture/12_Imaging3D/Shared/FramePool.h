@@ -0,0 +1,72 @@
+/*****************************************************************************************************
+ * Lecture sample code.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/imaging_learners/
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#pragma once
+#ifndef IP_FRAME_POOL_H
+#define IP_FRAME_POOL_H
+
+/* Include files */
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace ip
+{
+	/* Allocation statistics of a frame pool */
+	typedef struct framePoolStats {
+		uint64_t numberAllocated = 0;	// Buffers allocated from heap
+		uint64_t numberReused = 0;		// Requests served by pooled buffers
+		uint64_t numberReturned = 0;	// Buffers returned to pool on last release
+		size_t bytesAllocated = 0;		// Size of all buffers owned by pool (in use or pooled)
+		int buffersInUse = 0;			// Buffers referenced by Mats
+		int buffersPooled = 0;			// Buffers waiting for reuse
+	} framePoolStats;
+
+	/*! Pool of reference-counted frame buffers for per-frame processing without heap allocations.
+	*
+	* The pool is an OpenCV allocator. Mats allocated by the pool share a reference count as usual,
+	* and the buffer is returned to the pool when the last Mat referencing it is released. Requests
+	* for buffers of the same size in bytes (e.g., frames of the same size and type) reuse returned
+	* buffers, so that a processing loop does not allocate memory once all buffers have been created.
+	* Buffers are aligned as by cv::fastMalloc().
+	*
+	* The pool must outlive all Mats allocated by it. The default pool is never destroyed and can be
+	* installed as default allocator of all Mats.
+	*/
+	class FramePool : public cv::MatAllocator {
+	private:
+		mutable std::mutex poolMutex;
+		mutable std::map<size_t, std::vector<cv::UMatData*>> freeBuffers;	// Returned buffers by size in bytes
+		mutable framePoolStats statistics;
+
+	public:
+		FramePool(void) {}
+		~FramePool(void);
+		static FramePool& getDefault(void);
+		void setAsDefaultAllocator(void);
+
+		// Frames
+		void create(cv::Mat& frame, cv::Size size, int type);
+		void copy(const cv::Mat& source, cv::Mat& frame);
+
+		// Statistics and memory
+		framePoolStats getStatistics(void) const;
+		void trim(void);
+
+		// Interface cv::MatAllocator
+		cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override;
+		bool allocate(cv::UMatData* u, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override;
+		void deallocate(cv::UMatData* u) const override;
+	};
+}
+
+#endif /* IP_FRAME_POOL_H */
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/imaging_learners/
  * Copyright: 2023, Marc Hensel
- * Version: 2023.09.08
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -13,15 +13,49 @@
 #define VIDEO_STREAM_H
 
 /* Include files */
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <opencv2/opencv.hpp>
 
 /* Namespaces */
 using namespace std;
 using namespace cv;
 
+/* Handling of decoded frames when the ring buffer is full (asynchronous mode) */
+enum class DropPolicy {
+	LATEST_ONLY,	// Overwrite oldest frame when full, take newest frame (live cameras: process most recent frame)
+	NEVER_DROP		// Wait for a free slot, take oldest frame (video files: process each frame)
+};
+
 class VideoStream {
 private:
 	VideoCapture capture;
+	double framesPerSecond;
+
+	// Asynchronous decoding into a ring buffer of frames
+	thread decoder;							// Thread reading frames from capture
+	mutex ringMutex;						// Protects ring, its indices, and counters
+	condition_variable isNotEmpty;			// Signaled when a frame was queued or decoding ended
+	condition_variable isNotFull;			// Signaled when a frame was dequeued or decoding shall stop
+	vector<Mat> ring;						// Frames queued by decoder (buffers are recycled)
+	int ringHead, ringCount;				// Index of oldest frame and number of queued frames
+	DropPolicy dropPolicy;
+	bool isAsync, isStopping, isEndOfStream;
+	uint64_t numberDecoded, numberDropped;
+	Mat decodeBuffer;						// Frame being decoded (decoder thread only)
+	Mat outputBuffer;						// Frame taken from ring (caller thread only)
+
+	// Fused downscaling (area averaging) and gray conversion
+	Mat decodedFrame;						// Frame before scaling (synchronous mode)
+	Size tableSourceSize, tableTargetSize;	// Sizes the area tables have been computed for
+	vector<int> columnStart, columnIndex;	// Source columns of each target column (start index into columnIndex)
+	vector<float> columnWeight;				// Weights of source columns
+	vector<int> rowStart, rowIndex;			// Source rows of each target row (start index into rowIndex)
+	vector<float> rowWeight;				// Weights of source rows
+	vector<float> rowSum, areaSum;			// Horizontally averaged source row and accumulated target row
 
 public:
 	VideoStream(int cameraId);
@@ -30,6 +64,19 @@ public:
 
 	double getFramesPerSecond(void);
 	bool getNextFrame(Mat& frame, Mat* grayImage = NULL, double scaleFactor = 1.0);
+
+	// Asynchronous mode
+	void startAsync(int capacity = 4, DropPolicy policy = DropPolicy::NEVER_DROP);
+	void stopAsync(void);
+	int getQueueDepth(void);
+	uint64_t getNumberDecoded(void);
+	uint64_t getNumberDropped(void);
+
+private:
+	void init(void);
+	bool dequeueFrame(void);
+	void decodeFrames(void);
+	void scaleAndConvert(const Mat& source, Mat& frame, Mat* grayImage, double scaleFactor);
 };
 
 #endif /* VIDEO_STREAM_H */